@@ -8,11 +8,22 @@ namespace Financy
     constexpr auto SETTINGS_FILE_NAME = "Data/Settings.json";
     constexpr auto USER_FILE_NAME     = "Data/Users.json";
 
+    constexpr auto PURCHASE_FOLDER_NAME        = "Data/Purchases";
+    constexpr auto PURCHASE_MANIFEST_FILE_NAME = "Data/Purchases/Manifest.json";
+    constexpr auto PURCHASE_BACKUP_FILE_NAME   = "Data/Purchases.json.bak";
+
+    constexpr auto PICTURE_FOLDER_NAME = "Data/Pictures";
+
+    constexpr auto DATABASE_FILE_NAME = "Data/Financy.db";
+
     constexpr std::uint32_t MIN_STATEMENT_CLOSING_DAY = 1;
     constexpr std::uint32_t MAX_STATEMENT_CLOSING_DAY = 30;
 
     constexpr std::uint32_t MIN_INSTALLMENT_COUNT = 1;
     constexpr std::uint32_t MAX_INSTALLMENT_COUNT = 120;
 
-    constexpr auto FILES = { ACCOUNT_FILE_NAME, PURCHASE_FILE_NAME, USER_FILE_NAME, SETTINGS_FILE_NAME };
+    constexpr auto FILES = { ACCOUNT_FILE_NAME, USER_FILE_NAME, SETTINGS_FILE_NAME };
+
+    // Only moved into the data folder, purchases live in shards now
+    constexpr auto LEGACY_FILES = { PURCHASE_FILE_NAME };
 }
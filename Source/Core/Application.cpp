@@ -1,7 +1,9 @@
 #include "Application.hpp"
 
 #include "FileSystem.hpp"
+#include "IncubationController.hpp"
 
+#include "UI/AvatarProvider.hpp"
 #include "UI/Internal.hpp"
 
 namespace Financy
@@ -23,8 +25,15 @@ namespace Financy
 
     int Application::run(int argc, char *argv[])
     {
+        // Startup time up to the first frame, logged to compare QML compilation changes
+        QElapsedTimer startup;
+        startup.start();
+
         QApplication app(argc, argv);
 
+        // Internals, registered as the Internal singleton of Financy.Types and outliving the view
+        std::unique_ptr<Internal> internal = std::make_unique<Internal>();
+
         QQuickView viewer;
         viewer.setFlags(        Qt::WindowType::Window | Qt::WindowType::FramelessWindowHint);
         viewer.setResizeMode(   QQuickView::SizeRootObjectToView);
@@ -33,13 +42,13 @@ namespace Financy
         viewer.setTitle(        QString::fromStdString(m_title));
         viewer.setColor(        "transparent");
 
-        QQmlContext* content = viewer.rootContext();
+        // Owned by the view, pages incubated ahead of navigation are built between frames
+        viewer.engine()->setIncubationController(new IncubationController(&viewer));
 
-        // Internals
-        std::unique_ptr<Internal> m_internal = std::make_unique<Internal>();
-        content->setContextProperty(
-            "internal",
-            m_internal.release()
+        // Owned by the engine
+        viewer.engine()->addImageProvider(
+            AvatarProvider::PROVIDER_NAME,
+            new AvatarProvider()
         );
 
         viewer.setSource(QUrl("qrc:/Pages/Root.qml"));
@@ -51,6 +60,17 @@ namespace Financy
             &QWindow::close
         );
 
+        QObject::connect(
+            &viewer,
+            &QQuickWindow::frameSwapped,
+            &viewer,
+            [&startup]()
+            {
+                qInfo() << "Startup:" << startup.elapsed() << "ms to the first frame";
+            },
+            Qt::SingleShotConnection
+        );
+
         viewer.show();
 
         return app.exec();
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QtCore>
+
+namespace Financy
+{
+    // Who is looking and as of when. Computations take one instead of reading the logged in user and the
+    // app date, so they can run on worker threads or for several users at once
+    struct Context
+    {
+        // Accounts the viewer doesn't own only show the viewer's purchases, -1 when nobody is logged in
+        int viewerId = -1;
+
+        QDate asOf;
+
+        Context at(const QDate& inDate) const
+        {
+            Context result = *this;
+            result.asOf    = inDate;
+
+            return result;
+        }
+    };
+}
@@ -1,11 +1,19 @@
 #include "FileSystem.hpp"
 
 #include <iostream>
+#include <filesystem>
 #include <fstream>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 #ifdef OS_WINDOWS
     #include <windows.h>
     #include <tchar.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
 #endif
 
 #include "Helper.hpp"
@@ -84,30 +92,276 @@ namespace Financy
             #endif
         }
 
+        MappedFile::MappedFile(const std::string& inFilepath)
+        {
+            FileStatus status = getFileStatus(inFilepath);
+
+            if (!status.exists)
+            {
+                return;
+            }
+
+            m_isOpen = true;
+
+            // Nothing to map, an empty view is still a valid file
+            if (status.size == 0)
+            {
+                return;
+            }
+
+            #ifdef OS_WINDOWS
+                HANDLE file = CreateFileA(
+                    inFilepath.c_str(),
+                    GENERIC_READ,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                    NULL,
+                    OPEN_EXISTING,
+                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                    NULL
+                );
+
+                if (file != INVALID_HANDLE_VALUE)
+                {
+                    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+                    void* view     = mapping != NULL ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+                    if (view != nullptr)
+                    {
+                        m_file     = file;
+                        m_mapping  = mapping;
+                        m_data     = (const char*) view;
+                        m_size     = status.size;
+                        m_isMapped = true;
+
+                        return;
+                    }
+
+                    if (mapping != NULL)
+                    {
+                        CloseHandle(mapping);
+                    }
+
+                    CloseHandle(file);
+                }
+            #else
+                int file = ::open(inFilepath.c_str(), O_RDONLY);
+
+                if (file >= 0)
+                {
+                    void* view = mmap(nullptr, status.size, PROT_READ, MAP_PRIVATE, file, 0);
+
+                    // The mapping keeps its own reference to the file
+                    ::close(file);
+
+                    if (view != MAP_FAILED)
+                    {
+                        madvise(view, status.size, MADV_SEQUENTIAL);
+
+                        m_data     = (const char*) view;
+                        m_size     = status.size;
+                        m_isMapped = true;
+
+                        return;
+                    }
+                }
+            #endif
+
+            std::ifstream stream(inFilepath, std::ios::binary);
+
+            if (!stream.is_open())
+            {
+                m_isOpen = false;
+
+                return;
+            }
+
+            m_buffer.resize(status.size);
+
+            stream.read(m_buffer.data(), m_buffer.size());
+            m_buffer.resize(stream.gcount());
+
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+        }
+
+        MappedFile::~MappedFile()
+        {
+            close();
+        }
+
+        MappedFile::MappedFile(MappedFile&& ioOther) noexcept
+        {
+            *this = std::move(ioOther);
+        }
+
+        MappedFile& MappedFile::operator=(MappedFile&& ioOther) noexcept
+        {
+            if (this == &ioOther)
+            {
+                return *this;
+            }
+
+            close();
+
+            m_isOpen   = ioOther.m_isOpen;
+            m_isMapped = ioOther.m_isMapped;
+            m_size     = ioOther.m_size;
+            m_buffer   = std::move(ioOther.m_buffer);
+            m_data     = m_isMapped ? ioOther.m_data : m_buffer.data();
+
+            #ifdef OS_WINDOWS
+                m_file    = ioOther.m_file;
+                m_mapping = ioOther.m_mapping;
+
+                ioOther.m_file    = nullptr;
+                ioOther.m_mapping = nullptr;
+            #endif
+
+            ioOther.m_data     = nullptr;
+            ioOther.m_size     = 0;
+            ioOther.m_isOpen   = false;
+            ioOther.m_isMapped = false;
+
+            return *this;
+        }
+
+        bool MappedFile::isOpen() const
+        {
+            return m_isOpen;
+        }
+
+        bool MappedFile::isMapped() const
+        {
+            return m_isMapped;
+        }
+
+        const char* MappedFile::getData() const
+        {
+            return m_data;
+        }
+
+        std::size_t MappedFile::getSize() const
+        {
+            return m_size;
+        }
+
+        std::string_view MappedFile::getView() const
+        {
+            return m_data != nullptr ? std::string_view(m_data, m_size) : std::string_view();
+        }
+
+        void MappedFile::close()
+        {
+            if (m_isMapped)
+            {
+                #ifdef OS_WINDOWS
+                    UnmapViewOfFile(m_data);
+                    CloseHandle(m_mapping);
+                    CloseHandle(m_file);
+
+                    m_file    = nullptr;
+                    m_mapping = nullptr;
+                #else
+                    munmap((void*) m_data, m_size);
+                #endif
+            }
+
+            m_data     = nullptr;
+            m_size     = 0;
+            m_isOpen   = false;
+            m_isMapped = false;
+
+            m_buffer.clear();
+        }
+
+        FileStatus getFileStatus(const std::string& inFilepath)
+        {
+            FileStatus result {};
+
+            #ifdef OS_WINDOWS
+                struct _stat64 info;
+
+                if (_stat64(inFilepath.c_str(), &info) != 0)
+                {
+                    return result;
+                }
+
+                result.modified = (std::int64_t) info.st_mtime * 1000;
+            #else
+                struct stat info;
+
+                if (stat(inFilepath.c_str(), &info) != 0)
+                {
+                    return result;
+                }
+
+                #ifdef __APPLE__
+                    result.modified = ((std::int64_t) info.st_mtimespec.tv_sec * 1000) + (info.st_mtimespec.tv_nsec / 1000000);
+                #else
+                    result.modified = ((std::int64_t) info.st_mtim.tv_sec * 1000) + (info.st_mtim.tv_nsec / 1000000);
+                #endif
+            #endif
+
+            result.exists = (info.st_mode & S_IFMT) == S_IFREG;
+            result.size   = result.exists ? (std::uint64_t) info.st_size : 0;
+
+            return result;
+        }
+
         bool doesFileExist(const std::string& inFilepath)
         {
-            std::fstream f(inFilepath.c_str());
+            return getFileStatus(inFilepath).exists;
+        }
 
-            return f.good();
+        std::uint64_t getFileSize(const std::string& inFilepath)
+        {
+            return getFileStatus(inFilepath).size;
+        }
+
+        std::int64_t getModifiedTime(const std::string& inFilepath)
+        {
+            return getFileStatus(inFilepath).modified;
         }
 
         std::vector<char> readFile(const std::string& inFilepath)
         {
-            std::ifstream file(inFilepath, std::ios::ate | std::ios::binary);
+            MappedFile file(inFilepath);
 
-            if (file.is_open() == false)
+            if (!file.isOpen())
             {
                 throw std::runtime_error("Failed to open file -> " + inFilepath);
             }
-    
-            size_t fileSize = (size_t)file.tellg();
-            std::vector<char> buffer(fileSize);
-    
-            file.seekg(0);
-            file.read(buffer.data(), fileSize);
-            file.close();
-    
-            return buffer;
+
+            return std::vector<char>(file.getData(), file.getData() + file.getSize());
+        }
+
+        void writeFile(const std::string& inFilepath, std::string_view inData)
+        {
+            std::string temporaryPath = inFilepath + ".tmp";
+
+            {
+                std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+
+                if (!stream.is_open())
+                {
+                    throw std::runtime_error("Failed to open file -> " + temporaryPath);
+                }
+
+                stream.write(inData.data(), inData.size());
+            }
+
+            std::filesystem::rename(
+                temporaryPath,
+                inFilepath
+            );
+        }
+
+        std::future<MappedFile> readFileAsync(const std::string& inFilepath)
+        {
+            return std::async(
+                std::launch::async,
+                [inFilepath]() { return MappedFile(inFilepath); }
+            );
         }
     }
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstdint>
+#include <future>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "Core.hpp"
@@ -26,7 +29,70 @@ namespace Financy
             const std::vector<FileFormat>& inFileFormats
         );
 
+        struct FileStatus
+        {
+            bool exists = false;
+
+            std::uint64_t size    = 0;
+            std::int64_t modified = 0; // Milliseconds since epoch
+        };
+
+        // Read only view of a whole file, mapped where the OS allows it and read into memory otherwise
+        class MappedFile
+        {
+        public:
+            MappedFile() = default;
+            MappedFile(const std::string& inFilepath);
+            ~MappedFile();
+
+            MappedFile(MappedFile&& ioOther) noexcept;
+            MappedFile& operator=(MappedFile&& ioOther) noexcept;
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+        public:
+            bool isOpen() const;
+            bool isMapped() const;
+
+            const char* getData() const;
+            std::size_t getSize() const;
+            std::string_view getView() const;
+
+        private:
+            void close();
+
+        private:
+            const char* m_data = nullptr;
+            std::size_t m_size = 0;
+
+            bool m_isOpen   = false;
+            bool m_isMapped = false;
+
+            // Fallback storage when mapping fails
+            std::vector<char> m_buffer = {};
+
+            #ifdef OS_WINDOWS
+                void* m_file    = nullptr;
+                void* m_mapping = nullptr;
+            #endif
+        };
+
+        // A single stat call, nothing is opened
+        FileStatus getFileStatus(const std::string& inFilepath);
+
         bool doesFileExist(const std::string& inFilepath);
+        std::uint64_t getFileSize(const std::string& inFilepath);
+        std::int64_t getModifiedTime(const std::string& inFilepath);
+
+        // Owned copy, prefer MappedFile when the bytes are only parsed
         std::vector<char> readFile(const std::string& inFilepath);
+
+        // Writes next to the file and renames over it, readers never see half a file. Nothing may
+        // hold a MappedFile of inFilepath meanwhile, Windows refuses to replace a mapped file
+        void writeFile(const std::string& inFilepath, std::string_view inData);
+
+        // Opens, and for the fallback reads, the file on a worker thread
+        std::future<MappedFile> readFileAsync(const std::string& inFilepath);
     }
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+#include "Core/Forecast.hpp"
+
+#include <future>
+
+namespace Financy
+{
+    namespace Forecast
+    {
+        std::vector<Month> compute(
+            const Snapshot::ModelPtr& inModel,
+            const Context& inContext,
+            int inUserId,
+            std::uint32_t inCount
+        )
+        {
+            if (inModel == nullptr || inContext.viewerId < 0 || inCount == 0)
+            {
+                return {};
+            }
+
+            const UserData* viewer = Snapshot::getUser(*inModel, inContext.viewerId);
+
+            if (viewer == nullptr)
+            {
+                return {};
+            }
+
+            // Every worker only reads its own immutable account version, the caller waits for all of them
+            std::vector<std::future<std::vector<Search::Rollup::Totals>>> workers {};
+
+            for (const Snapshot::AccountPtr& account : inModel->accounts)
+            {
+                const AccountData& data = account->data;
+
+                bool isVisible = data.userId == viewer->id || data.sharedUserIds.contains((int) viewer->id);
+
+                if (data.type != Account::Type::Expense || !isVisible)
+                {
+                    continue;
+                }
+
+                workers.push_back(
+                    std::async(
+                        std::launch::async,
+                        [account, inContext, inUserId, inCount]()
+                        {
+                            Search::Rollup rollup(account->data.closingDay);
+
+                            Snapshot::forEachPurchase(
+                                *account,
+                                inContext,
+                                inUserId,
+                                [&rollup](const PurchaseData& inPurchase) { rollup.add(inPurchase); }
+                            );
+
+                            return rollup.get(
+                                Search::Rollup::getStatementIndex(inContext.asOf, account->data.closingDay),
+                                inCount
+                            );
+                        }
+                    )
+                );
+            }
+
+            std::vector<Month> result(inCount);
+
+            for (std::uint32_t i = 0; i < inCount; i++)
+            {
+                result[i].date   = inContext.asOf.addMonths(i);
+                result[i].income = viewer->income;
+            }
+
+            for (auto& worker : workers)
+            {
+                std::vector<Search::Rollup::Totals> totals = worker.get();
+
+                for (std::uint32_t i = 0; i < inCount; i++)
+                {
+                    result[i].installments += totals[i].installments;
+                    result[i].recurring    += totals[i].recurring;
+                }
+            }
+
+            for (Month& month : result)
+            {
+                month.due   = month.installments + month.recurring;
+                month.saved = month.income - month.due;
+            }
+
+            return result;
+        }
+    }
+}
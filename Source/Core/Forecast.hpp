@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include <QtCore>
+
+#include "Core/Context.hpp"
+#include "Core/Snapshot.hpp"
+
+namespace Financy
+{
+    namespace Forecast
+    {
+        struct Month
+        {
+            QDate date;
+
+            float installments = 0.0f;
+            float recurring    = 0.0f;
+            float due          = 0.0f;
+
+            float income = 0.0f;
+            float saved  = 0.0f;
+        };
+
+        // inCount statements from the context's date across the viewer's expense accounts, one worker per account.
+        // Runs on the pinned snapshot, edits made meanwhile don't show up halfway
+        std::vector<Month> compute(
+            const Snapshot::ModelPtr& inModel,
+            const Context& inContext,
+            int inUserId,
+            std::uint32_t inCount
+        );
+    }
+}
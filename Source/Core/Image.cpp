@@ -0,0 +1,72 @@
+#include "Core/Image.hpp"
+
+#include <QBuffer>
+#include <QImageReader>
+
+#include "Core/FileSystem.hpp"
+#include "Core/Palette.hpp"
+
+namespace Financy
+{
+    namespace Image
+    {
+        QImage decode(const std::string& inFilepath, std::uint32_t inMaxSize)
+        {
+            FileSystem::MappedFile file(inFilepath);
+
+            if (!file.isOpen())
+            {
+                return QImage();
+            }
+
+            // The codec reads straight out of the mapping
+            QByteArray data = QByteArray::fromRawData(file.getData(), file.getSize());
+
+            QBuffer buffer(&data);
+            buffer.open(QIODevice::ReadOnly);
+
+            QImageReader reader(&buffer);
+            reader.setAutoTransform(true);
+
+            QSize size = reader.size();
+
+            // Let the codec downsample while decoding instead of scaling a full resolution copy
+            if (size.isValid() && (size.width() > (int) inMaxSize || size.height() > (int) inMaxSize))
+            {
+                reader.setScaledSize(
+                    size.scaled(
+                        inMaxSize,
+                        inMaxSize,
+                        Qt::KeepAspectRatio
+                    )
+                );
+            }
+
+            QImage result = reader.read();
+
+            if (result.isNull())
+            {
+                return result;
+            }
+
+            result.convertTo(QImage::Format_RGBA8888);
+
+            return result;
+        }
+
+        QList<QColor> getColors(const QImage& inImage)
+        {
+            if (inImage.isNull() || inImage.format() != QImage::Format_RGBA8888)
+            {
+                return { "#000000", "#FFFFFF" };
+            }
+
+            return Palette::pickColors(Palette::extract(inImage));
+        }
+
+        QList<QColor> getColors(const std::string& inFilepath)
+        {
+            return getColors(decode(inFilepath));
+        }
+    }
+}
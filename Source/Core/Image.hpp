@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+
+#include <QtCore>
+#include <QColor>
+#include <QImage>
+
+namespace Financy
+{
+    namespace Image
+    {
+        // Longest side, in pixels, images are decoded at for colour analysis
+        constexpr std::uint32_t ANALYSIS_SIZE = 256;
+
+        QImage decode(const std::string& inFilepath, std::uint32_t inMaxSize = ANALYSIS_SIZE);
+
+        QList<QColor> getColors(const QImage& inImage);
+        QList<QColor> getColors(const std::string& inFilepath);
+    }
+}
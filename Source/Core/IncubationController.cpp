@@ -0,0 +1,51 @@
+#include "IncubationController.hpp"
+
+#include <algorithm>
+
+namespace Financy
+{
+    IncubationController::IncubationController(QQuickWindow* inWindow)
+        : QObject(inWindow),
+        QQmlIncubationController(),
+        m_window(inWindow)
+    {
+        QObject::connect(
+            m_window,
+            &QQuickWindow::afterAnimating,
+            this,
+            &IncubationController::incubate
+        );
+    }
+
+    void IncubationController::incubatingObjectCountChanged(int inCount)
+    {
+        if (inCount <= 0)
+        {
+            return;
+        }
+
+        // An idle window renders no frames, ask for one to get the slices going
+        m_window->update();
+    }
+
+    void IncubationController::incubate()
+    {
+        if (incubatingObjectCount() <= 0)
+        {
+            return;
+        }
+
+        qreal refreshRate = m_window->screen() != nullptr ? m_window->screen()->refreshRate() : 60.0;
+
+        incubateFor(
+            std::max(1, (int) ((1000.0 / std::max(refreshRate, 1.0)) * FRAME_SHARE))
+        );
+
+        if (incubatingObjectCount() <= 0)
+        {
+            return;
+        }
+
+        m_window->update();
+    }
+}
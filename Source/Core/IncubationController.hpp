@@ -0,0 +1,32 @@
+#pragma once
+
+#include <QtCore>
+#include <QtQuick>
+#include <QQmlIncubationController>
+
+namespace Financy
+{
+    // Runs asynchronous QML creation in slices after each frame's animations, so pages built ahead of
+    // navigation never take more than a share of a frame
+    class IncubationController : public QObject, public QQmlIncubationController
+    {
+        Q_OBJECT
+
+    public:
+        // Share of the frame interval handed to incubation
+        static constexpr float FRAME_SHARE = 0.33f;
+
+    public:
+        IncubationController(QQuickWindow* inWindow);
+        ~IncubationController() = default;
+
+    protected:
+        void incubatingObjectCountChanged(int inCount) override;
+
+    private:
+        void incubate();
+
+    private:
+        QQuickWindow* m_window;
+    };
+}
@@ -0,0 +1,143 @@
+#include "Core/Journal.hpp"
+
+namespace Financy
+{
+    std::size_t Change::getSize() const
+    {
+        std::size_t result = sizeof(Change) + sharedAccountIds.size() * sizeof(std::uint32_t);
+
+        for (const PurchaseData& purchase : purchases)
+        {
+            result += purchase.getSize();
+        }
+
+        for (const AccountData& account : accounts)
+        {
+            result += account.getSize();
+        }
+
+        for (const UserData& user : users)
+        {
+            result += user.getSize();
+        }
+
+        return result;
+    }
+
+    Journal::Journal(QObject* parent)
+        : QObject(parent),
+        m_undo({}),
+        m_redo({}),
+        m_size(0),
+        m_pauseCount(0)
+    {
+    }
+
+    void Journal::record(Change&& inChange)
+    {
+        if (m_pauseCount > 0)
+        {
+            return;
+        }
+
+        for (const Change& change : m_redo)
+        {
+            m_size -= change.getSize();
+        }
+
+        m_redo.clear();
+
+        m_size += inChange.getSize();
+        m_undo.push_back(std::move(inChange));
+
+        trim();
+
+        emit onEdit();
+    }
+
+    bool Journal::undo(const std::function<bool(const Change&)>& inApply)
+    {
+        return move(m_undo, m_redo, inApply);
+    }
+
+    bool Journal::redo(const std::function<bool(const Change&)>& inApply)
+    {
+        return move(m_redo, m_undo, inApply);
+    }
+
+    void Journal::pause()
+    {
+        m_pauseCount++;
+    }
+
+    void Journal::resume()
+    {
+        if (m_pauseCount == 0)
+        {
+            return;
+        }
+
+        m_pauseCount--;
+    }
+
+    void Journal::clear()
+    {
+        m_undo.clear();
+        m_redo.clear();
+
+        m_size = 0;
+
+        emit onEdit();
+    }
+
+    bool Journal::canUndo() const
+    {
+        return !m_undo.empty();
+    }
+
+    bool Journal::canRedo() const
+    {
+        return !m_redo.empty();
+    }
+
+    std::size_t Journal::getSize() const
+    {
+        return m_size;
+    }
+
+    bool Journal::move(std::deque<Change>& ioFrom, std::deque<Change>& ioTo, const std::function<bool(const Change&)>& inApply)
+    {
+        if (ioFrom.empty())
+        {
+            return false;
+        }
+
+        pause();
+
+        bool didApply = inApply(ioFrom.back());
+
+        resume();
+
+        if (!didApply)
+        {
+            return false;
+        }
+
+        ioTo.push_back(std::move(ioFrom.back()));
+        ioFrom.pop_back();
+
+        emit onEdit();
+
+        return true;
+    }
+
+    void Journal::trim()
+    {
+        // Oldest history goes first, a single change over the budget isn't kept at all
+        while (m_size > MAX_SIZE && !m_undo.empty())
+        {
+            m_size -= m_undo.front().getSize();
+            m_undo.pop_front();
+        }
+    }
+}
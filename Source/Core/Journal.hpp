@@ -0,0 +1,103 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+
+#include "UI/Account.hpp"
+#include "UI/Purchase.hpp"
+#include "UI/User.hpp"
+
+namespace Financy
+{
+    // A destructive mutation with just enough data to revert or replay it
+    struct Change
+    {
+        enum class Type
+        {
+            DeletePurchases = 0,
+            DeleteAccount,
+            DeleteUser
+        };
+
+        Type type = Type::DeletePurchases;
+
+        // Who made it, replays only run while that user is logged in
+        std::uint32_t userId    = 0;
+        std::uint32_t accountId = 0;
+
+        std::vector<PurchaseData> purchases;
+
+        // Owned accounts that went away with their purchases, empty when the user only left a shared account
+        std::vector<AccountData> accounts;
+
+        std::vector<UserData> users;
+
+        // Accounts the deleted user had been shared
+        std::vector<std::uint32_t> sharedAccountIds;
+
+        std::size_t getSize() const;
+    };
+
+    // Undo and redo stacks of changes, trimmed from the oldest end past MAX_SIZE bytes
+    class Journal : public QObject
+    {
+        Q_OBJECT
+        QML_ANONYMOUS
+
+        Q_PROPERTY(
+            bool canUndo
+            READ canUndo
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            bool canRedo
+            READ canRedo
+            NOTIFY onEdit
+        )
+
+    public:
+        static constexpr std::size_t MAX_SIZE = 8 * 1024 * 1024;
+
+    signals:
+        void onEdit();
+
+    public:
+        Journal(QObject* parent = nullptr);
+        ~Journal() = default;
+
+    public:
+        // Drops the redo side, ignored while paused
+        void record(Change&& inChange);
+
+        // inApply gets the latest change and moves it to the other stack when it returns true
+        bool undo(const std::function<bool(const Change&)>& inApply);
+        bool redo(const std::function<bool(const Change&)>& inApply);
+
+        // Nested mutations of a change already being recorded or replayed stay out of the journal
+        void pause();
+        void resume();
+
+        void clear();
+
+        bool canUndo() const;
+        bool canRedo() const;
+
+        std::size_t getSize() const;
+
+    private:
+        bool move(std::deque<Change>& ioFrom, std::deque<Change>& ioTo, const std::function<bool(const Change&)>& inApply);
+
+        void trim();
+
+    private:
+        std::deque<Change> m_undo;
+        std::deque<Change> m_redo;
+
+        std::size_t m_size;
+        std::uint32_t m_pauseCount;
+    };
+}
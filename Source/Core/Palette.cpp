@@ -0,0 +1,358 @@
+#include "Core/Palette.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <opencv2/core.hpp>
+#include <opencv2/imgproc.hpp>
+
+namespace Financy
+{
+    namespace Palette
+    {
+        constexpr std::uint32_t CHANNEL_SHIFT = 8 - HISTOGRAM_BITS;
+        constexpr std::uint32_t CHANNEL_MASK  = (1 << HISTOGRAM_BITS) - 1;
+
+        // Luminance where black and white text have the same contrast
+        constexpr float MID_LUMINANCE = 0.179f;
+
+        float getDistance(const cv::Vec3f& inA, const cv::Vec3f& inB)
+        {
+            cv::Vec3f delta = inA - inB;
+
+            return delta.dot(delta);
+        }
+
+        cv::Mat getHistogram(const QImage& inImage)
+        {
+            const cv::Mat pixels(
+                inImage.height(),
+                inImage.width(),
+                CV_8UC4,
+                (void*) inImage.constBits(),
+                inImage.bytesPerLine()
+            );
+
+            cv::Mat alpha;
+            cv::extractChannel(pixels, alpha, 3);
+
+            cv::Mat mask = alpha > 127;
+
+            // OpenCV's vectorized kernels do the per pixel work: drop the low bits of every channel
+            // and fold the three channels into a single bin index
+            cv::Mat quantized;
+            cv::cvtColor(pixels, quantized, cv::COLOR_RGBA2RGB);
+            cv::bitwise_and(
+                quantized,
+                cv::Scalar::all((CHANNEL_MASK << CHANNEL_SHIFT) & 0xFF),
+                quantized
+            );
+            quantized.convertTo(quantized, CV_32F);
+
+            const float step = (float) (1 << CHANNEL_SHIFT);
+
+            cv::Mat indices;
+            cv::transform(
+                quantized,
+                indices,
+                cv::Matx13f(
+                    (float) (1 << (HISTOGRAM_BITS * 2)) / step,
+                    (float) (1 << HISTOGRAM_BITS) / step,
+                    1.0f / step
+                )
+            );
+
+            int channel          = 0;
+            int histogramSize    = HISTOGRAM_SIZE;
+            float range[]        = { 0.0f, (float) HISTOGRAM_SIZE };
+            const float* ranges  = range;
+
+            cv::Mat result;
+            cv::calcHist(
+                &indices,
+                1,
+                &channel,
+                mask,
+                result,
+                1,
+                &histogramSize,
+                &ranges
+            );
+
+            return result;
+        }
+
+        std::vector<Swatch> extract(const QImage& inImage, std::uint32_t inCount)
+        {
+            if (inImage.isNull() || inImage.format() != QImage::Format_RGBA8888 || inCount == 0)
+            {
+                return {};
+            }
+
+            cv::Mat histogram = getHistogram(inImage);
+
+            std::vector<cv::Vec3f> colors {};
+            std::vector<float> weights {};
+
+            const float half = (float) (1 << CHANNEL_SHIFT) * 0.5f;
+
+            for (std::uint32_t bin = 0; bin < HISTOGRAM_SIZE; bin++)
+            {
+                float count = histogram.at<float>((int) bin);
+
+                if (count <= 0.0f)
+                {
+                    continue;
+                }
+
+                colors.push_back(
+                    cv::Vec3f(
+                        ((((bin >> (HISTOGRAM_BITS * 2)) & CHANNEL_MASK) << CHANNEL_SHIFT) + half) / 255.0f,
+                        ((((bin >> HISTOGRAM_BITS) & CHANNEL_MASK) << CHANNEL_SHIFT) + half) / 255.0f,
+                        (((bin & CHANNEL_MASK) << CHANNEL_SHIFT) + half) / 255.0f
+                    )
+                );
+                weights.push_back(count);
+            }
+
+            if (colors.empty())
+            {
+                return {};
+            }
+
+            // Cluster the occupied bins, not the pixels, in a perceptual space
+            cv::Mat samples(1, (int) colors.size(), CV_32FC3, colors.data());
+            cv::Mat labSamples;
+            cv::cvtColor(samples, labSamples, cv::COLOR_RGB2Lab);
+
+            const cv::Vec3f* lab = labSamples.ptr<cv::Vec3f>(0);
+            const std::size_t sampleCount = colors.size();
+            const std::size_t count       = std::min((std::size_t) inCount, sampleCount);
+
+            std::vector<cv::Vec3f> centroids {};
+            centroids.push_back(lab[std::max_element(weights.begin(), weights.end()) - weights.begin()]);
+
+            std::vector<float> nearest(sampleCount, std::numeric_limits<float>::max());
+
+            while (centroids.size() < count)
+            {
+                std::size_t farthest = 0;
+                float farthestScore  = -1.0f;
+
+                for (std::size_t i = 0; i < sampleCount; i++)
+                {
+                    nearest[i] = std::min(
+                        nearest[i],
+                        getDistance(lab[i], centroids.back())
+                    );
+
+                    float score = nearest[i] * weights[i];
+
+                    if (score <= farthestScore)
+                    {
+                        continue;
+                    }
+
+                    farthest      = i;
+                    farthestScore = score;
+                }
+
+                centroids.push_back(lab[farthest]);
+            }
+
+            std::vector<std::uint32_t> assignments(sampleCount, 0);
+            std::vector<float> clusterWeights(count, 0.0f);
+
+            for (std::uint32_t iteration = 0; iteration < MAX_ITERATIONS; iteration++)
+            {
+                bool didChange = iteration == 0;
+
+                for (std::size_t i = 0; i < sampleCount; i++)
+                {
+                    std::uint32_t closest = 0;
+                    float closestDistance = std::numeric_limits<float>::max();
+
+                    for (std::uint32_t j = 0; j < count; j++)
+                    {
+                        float distance = getDistance(lab[i], centroids[j]);
+
+                        if (distance >= closestDistance)
+                        {
+                            continue;
+                        }
+
+                        closest         = j;
+                        closestDistance = distance;
+                    }
+
+                    didChange      = didChange || assignments[i] != closest;
+                    assignments[i] = closest;
+                }
+
+                if (!didChange)
+                {
+                    break;
+                }
+
+                std::vector<cv::Vec3f> sums(count, cv::Vec3f(0.0f, 0.0f, 0.0f));
+                std::fill(clusterWeights.begin(), clusterWeights.end(), 0.0f);
+
+                for (std::size_t i = 0; i < sampleCount; i++)
+                {
+                    sums[assignments[i]]           += lab[i] * weights[i];
+                    clusterWeights[assignments[i]] += weights[i];
+                }
+
+                for (std::uint32_t j = 0; j < count; j++)
+                {
+                    if (clusterWeights[j] <= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    centroids[j] = sums[j] * (1.0f / clusterWeights[j]);
+                }
+            }
+
+            cv::Mat labCentroids(1, (int) count, CV_32FC3, centroids.data());
+            cv::Mat rgbCentroids;
+            cv::cvtColor(labCentroids, rgbCentroids, cv::COLOR_Lab2RGB);
+
+            const cv::Vec3f* rgb = rgbCentroids.ptr<cv::Vec3f>(0);
+
+            float totalWeight = 0.0f;
+
+            for (float weight : clusterWeights)
+            {
+                totalWeight += weight;
+            }
+
+            std::vector<Swatch> result {};
+
+            for (std::uint32_t j = 0; j < count; j++)
+            {
+                if (clusterWeights[j] <= 0.0f)
+                {
+                    continue;
+                }
+
+                Swatch swatch;
+                swatch.color = QColor::fromRgbF(
+                    std::clamp(rgb[j][0], 0.0f, 1.0f),
+                    std::clamp(rgb[j][1], 0.0f, 1.0f),
+                    std::clamp(rgb[j][2], 0.0f, 1.0f)
+                );
+                swatch.weight = clusterWeights[j] / totalWeight;
+
+                result.push_back(swatch);
+            }
+
+            std::sort(
+                result.begin(),
+                result.end(),
+                [](const Swatch& a, const Swatch& b) { return a.weight > b.weight; }
+            );
+
+            return result;
+        }
+
+        QColor ensureContrast(const QColor& inBackground, const QColor& inForeground)
+        {
+            if (getContrastRatio(inBackground, inForeground) >= MIN_CONTRAST_RATIO)
+            {
+                return inForeground;
+            }
+
+            bool willDarken = getLuminance(inBackground) > MID_LUMINANCE;
+
+            float hue        = std::max(inForeground.hslHueF(), 0.0f);
+            float saturation = inForeground.hslSaturationF();
+            float lightness  = inForeground.lightnessF();
+
+            while (lightness > 0.0f && lightness < 1.0f)
+            {
+                lightness = std::clamp(
+                    lightness + (willDarken ? -0.05f : 0.05f),
+                    0.0f,
+                    1.0f
+                );
+
+                QColor result = QColor::fromHslF(hue, saturation, lightness);
+
+                if (getContrastRatio(inBackground, result) >= MIN_CONTRAST_RATIO)
+                {
+                    return result;
+                }
+            }
+
+            return willDarken ? QColor("#000000") : QColor("#FFFFFF");
+        }
+
+        QList<QColor> pickColors(const std::vector<Swatch>& inSwatches)
+        {
+            if (inSwatches.empty())
+            {
+                return { "#000000", "#FFFFFF" };
+            }
+
+            // Favour large areas, but let a vivid cluster win over a slightly bigger grey one
+            auto primary = std::max_element(
+                inSwatches.begin(),
+                inSwatches.end(),
+                [](const Swatch& a, const Swatch& b)
+                {
+                    float chromaA = a.color.hsvSaturationF() * a.color.valueF();
+                    float chromaB = b.color.hsvSaturationF() * b.color.valueF();
+
+                    return a.weight * (0.5f + chromaA) < b.weight * (0.5f + chromaB);
+                }
+            );
+
+            QColor primaryColor   = primary->color;
+            QColor secondaryColor = primaryColor;
+            float bestContrast    = 0.0f;
+
+            for (const Swatch& swatch : inSwatches)
+            {
+                float contrast = getContrastRatio(primaryColor, swatch.color);
+
+                if (contrast <= bestContrast)
+                {
+                    continue;
+                }
+
+                secondaryColor = swatch.color;
+                bestContrast   = contrast;
+            }
+
+            QList<QColor> result;
+            result.push_back(primaryColor);
+            result.push_back(ensureContrast(primaryColor, secondaryColor));
+
+            return result;
+        }
+
+        float getLuminance(const QColor& inColor)
+        {
+            auto linearize = [](float inChannel)
+            {
+                return inChannel <= 0.03928f ?
+                    inChannel / 12.92f :
+                    std::pow((inChannel + 0.055f) / 1.055f, 2.4f);
+            };
+
+            return (0.2126f * linearize(inColor.redF())) +
+                (0.7152f * linearize(inColor.greenF())) +
+                (0.0722f * linearize(inColor.blueF()));
+        }
+
+        float getContrastRatio(const QColor& inColorA, const QColor& inColorB)
+        {
+            float luminanceA = getLuminance(inColorA);
+            float luminanceB = getLuminance(inColorB);
+
+            return (std::max(luminanceA, luminanceB) + 0.05f) / (std::min(luminanceA, luminanceB) + 0.05f);
+        }
+    }
+}
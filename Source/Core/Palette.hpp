@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include <QtCore>
+#include <QColor>
+#include <QImage>
+
+namespace Financy
+{
+    namespace Palette
+    {
+        // 5 bits per channel
+        constexpr std::uint32_t HISTOGRAM_BITS  = 5;
+        constexpr std::uint32_t HISTOGRAM_SIZE  = 1 << (HISTOGRAM_BITS * 3);
+
+        constexpr std::uint32_t CLUSTER_COUNT   = 5;
+        constexpr std::uint32_t MAX_ITERATIONS  = 16;
+
+        // WCAG AA for normal text
+        constexpr float MIN_CONTRAST_RATIO = 4.5f;
+
+        struct Swatch
+        {
+            QColor color = "#000000";
+            float weight = 0.0f;
+        };
+
+        std::vector<Swatch> extract(const QImage& inImage, std::uint32_t inCount = CLUSTER_COUNT);
+
+        QList<QColor> pickColors(const std::vector<Swatch>& inSwatches);
+
+        float getLuminance(const QColor& inColor);
+        float getContrastRatio(const QColor& inColorA, const QColor& inColorB);
+    }
+}
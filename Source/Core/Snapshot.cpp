@@ -0,0 +1,122 @@
+#include "Core/Snapshot.hpp"
+
+#include <atomic>
+#include <unordered_map>
+
+namespace Financy
+{
+    namespace Snapshot
+    {
+        ModelPtr published = std::make_shared<const Model>();
+
+        AccountPtr build(Financy::Account* inAccount, const AccountPtr& inPrevious)
+        {
+            AccountData data = inAccount->toData();
+
+            // Seen by the owner, so every user's purchases are included
+            Context owner;
+            owner.viewerId = (int) data.userId;
+
+            QList<Purchase*> purchases = inAccount->getPurchases(owner);
+
+            std::unordered_map<std::uint32_t, std::shared_ptr<const PurchaseData>> previous {};
+
+            if (inPrevious != nullptr)
+            {
+                for (const std::shared_ptr<const PurchaseData>& purchase : inPrevious->purchases)
+                {
+                    previous[purchase->id] = purchase;
+                }
+            }
+
+            std::shared_ptr<Account> result = std::make_shared<Account>();
+            result->version = inPrevious != nullptr ? inPrevious->version + 1 : 1;
+            result->data    = data;
+            result->purchases.reserve(purchases.size());
+
+            bool didChange = inPrevious == nullptr ||
+                !(inPrevious->data == data) ||
+                inPrevious->purchases.size() != (std::size_t) purchases.size();
+
+            for (Purchase* purchase : purchases)
+            {
+                PurchaseData purchaseData = purchase->toData();
+
+                auto iterator = previous.find(purchaseData.id);
+
+                if (iterator != previous.end() && *iterator->second == purchaseData)
+                {
+                    result->purchases.push_back(iterator->second);
+
+                    continue;
+                }
+
+                result->purchases.push_back(std::make_shared<const PurchaseData>(std::move(purchaseData)));
+
+                didChange = true;
+            }
+
+            if (!didChange)
+            {
+                return inPrevious;
+            }
+
+            return result;
+        }
+
+        ModelPtr load()
+        {
+            return std::atomic_load(&published);
+        }
+
+        void publish(const ModelPtr& inModel)
+        {
+            std::atomic_store(&published, inModel);
+        }
+
+        const UserData* getUser(const Model& inModel, std::uint32_t inId)
+        {
+            for (const std::shared_ptr<const UserData>& user : inModel.users)
+            {
+                if (user->id == inId)
+                {
+                    return user.get();
+                }
+            }
+
+            return nullptr;
+        }
+
+        void forEachPurchase(
+            const Account& inAccount,
+            const Context& inContext,
+            int inUserId,
+            const std::function<void(const PurchaseData&)>& inCallback
+        )
+        {
+            bool isOwner = inContext.viewerId >= 0 && inAccount.data.userId == (std::uint32_t) inContext.viewerId;
+
+            int userId = inUserId;
+
+            if (inUserId >= 0 || !isOwner)
+            {
+                if (inContext.viewerId < 0)
+                {
+                    return;
+                }
+
+                userId = inUserId >= 0 ? inUserId : inContext.viewerId;
+            }
+
+            for (const std::shared_ptr<const PurchaseData>& purchase : inAccount.purchases)
+            {
+                if (userId >= 0 && purchase->userId != (std::uint32_t) userId)
+                {
+                    continue;
+                }
+
+                inCallback(*purchase);
+            }
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <QtCore>
+
+#include "Core/Context.hpp"
+#include "UI/Account.hpp"
+#include "UI/Purchase.hpp"
+#include "UI/User.hpp"
+
+namespace Financy
+{
+    // Immutable versions of the data model for readers off the UI thread. Holding a pointer pins the version,
+    // it is reclaimed when the last reader lets go of it
+    namespace Snapshot
+    {
+        struct Account
+        {
+            std::uint64_t version = 0;
+
+            // Fields only, purchases live below
+            AccountData data;
+
+            // Purchases that didn't change are shared with the previous version
+            std::vector<std::shared_ptr<const PurchaseData>> purchases;
+        };
+
+        struct Model
+        {
+            std::uint64_t version = 0;
+
+            std::vector<std::shared_ptr<const UserData>> users;
+            std::vector<std::shared_ptr<const Account>> accounts;
+        };
+
+        typedef std::shared_ptr<const Account> AccountPtr;
+        typedef std::shared_ptr<const Model> ModelPtr;
+
+        // Next version of inAccount reusing whatever inPrevious already holds, inPrevious when nothing changed
+        AccountPtr build(Financy::Account* inAccount, const AccountPtr& inPrevious);
+
+        // Last published model, safe from any thread
+        ModelPtr load();
+        void publish(const ModelPtr& inModel);
+
+        const UserData* getUser(const Model& inModel, std::uint32_t inId);
+
+        // Same visibility rules as Account::forEachPurchase
+        void forEachPurchase(
+            const Account& inAccount,
+            const Context& inContext,
+            int inUserId,
+            const std::function<void(const PurchaseData&)>& inCallback
+        );
+    }
+}
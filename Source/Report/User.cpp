@@ -6,7 +6,6 @@
 
 #include "hpdf.h"
 
-#include "Core/Globals.hpp"
 #include "UI/Account.hpp"
 #include "UI/Purchase.hpp"
 #include "UI/User.hpp"
@@ -30,11 +29,14 @@ namespace Financy
         void generateAccountHeader(
             HPDF_Page& outPage,
             Account* inAccount,
+            const Context& inContext,
             const HPDF_Font& inFont,
             const HPDF_Rect& inRect
         )
         {
-            if (inAccount->getDueAmount() <= 0.0f)
+            float dueAmount = inAccount->getDueAmount(inContext);
+
+            if (dueAmount <= 0.0f)
             {
                 return;
             }
@@ -43,7 +45,7 @@ namespace Financy
 
             const std::string& name = inAccount->getName().toStdString();
 
-            std::string totalValue = std::to_string(inAccount->getDueAmount());
+            std::string totalValue = std::to_string(dueAmount);
             totalValue             = std::string(totalValue.begin(), totalValue.end() - 5);
 
             HPDF_Rect rect;
@@ -184,13 +186,14 @@ namespace Financy
         void generateTotalFooter(
             HPDF_Page& outPage,
             User* inUser,
+            const Context& inContext,
             const HPDF_Font& inFont,
             const HPDF_Rect& inRect
         )
         {
             const std::uint32_t halvedFontSize = TITLE_FONT_SIZE * 0.5f;
 
-            std::string totalValue = std::to_string(inUser->getDueAmount());
+            std::string totalValue = std::to_string(inUser->getDueAmount(inContext));
             totalValue             = std::string(totalValue.begin(), totalValue.end() - 5);
 
             std::string total = totalValue;
@@ -282,11 +285,12 @@ namespace Financy
 
             HPDF_Rect currentRect = defaultRect;
 
-            QDate currentDate = Globals::getCurrentDate();
+            const Context& context = inProps.context;
+            const QDate& currentDate = context.asOf;
 
             for (Account* account : inProps.user->getAccounts(Account::Type::Expense))
             {
-                if (account->getDueAmount() <= 0.0f)
+                if (account->getDueAmount(context) <= 0.0f)
                 {
                     continue;
                 }
@@ -296,6 +300,7 @@ namespace Financy
                 generateAccountHeader(
                     page,
                     account,
+                    context,
                     font,
                     currentRect
                 );
@@ -306,7 +311,7 @@ namespace Financy
 
                 std::uint32_t closingDay = account->getClosingDay();
 
-                for (Purchase* purchase : account->getPurchases())
+                for (Purchase* purchase : account->getPurchases(context))
                 {
                     if (purchase->isFullyPaid(currentDate, closingDay))
                     {
@@ -348,6 +353,7 @@ namespace Financy
             generateTotalFooter(
                 page,
                 inProps.user,
+                context,
                 font,
                 currentRect
             );
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Report.hpp"
+#include "Core/Context.hpp"
 
 namespace Financy
 {
@@ -11,6 +12,9 @@ namespace Financy
         struct UserProps : Props
         {
             User* user = nullptr;
+
+            // Whose view and as of when the report is taken
+            Context context;
         };
 
         void generatreUserReport(const UserProps& inProps);
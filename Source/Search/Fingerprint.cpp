@@ -0,0 +1,117 @@
+#include "Search/Fingerprint.hpp"
+
+#include <cmath>
+
+#include "Search/Text.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ull;
+        constexpr std::uint64_t FNV_PRIME  = 1099511628211ull;
+
+        void combine(std::uint64_t& ioHash, std::uint64_t inValue)
+        {
+            for (std::uint32_t i = 0; i < 8; i++)
+            {
+                ioHash ^= (inValue >> (i * 8)) & 0xFF;
+                ioHash *= FNV_PRIME;
+            }
+        }
+
+        std::uint64_t getFingerprint(
+            const QDate& inDate,
+            const QString& inName,
+            float inValue,
+            std::uint32_t inInstallments,
+            std::uint32_t inUserId
+        )
+        {
+            std::uint64_t result = FNV_OFFSET;
+
+            combine(result, (std::uint64_t) inDate.toJulianDay());
+
+            // Case, accents, punctuation and spacing differ between exports of the same charge
+            for (const QString& token : tokenize(inName))
+            {
+                for (const QChar& character : token)
+                {
+                    combine(result, character.unicode());
+                }
+
+                combine(result, ' ');
+            }
+
+            combine(result, (std::uint64_t) std::llround((double) inValue * 100.0));
+            combine(result, inInstallments);
+            combine(result, inUserId);
+
+            return result;
+        }
+
+        std::uint64_t getFingerprint(Purchase* inPurchase)
+        {
+            return getFingerprint(
+                inPurchase->getDate(),
+                inPurchase->getName(),
+                inPurchase->getValue(),
+                inPurchase->getInstallments(),
+                inPurchase->getUserId()
+            );
+        }
+
+        FingerprintCounts countFingerprints(const QList<Purchase*>& inPurchases)
+        {
+            FingerprintCounts result {};
+            result.reserve(inPurchases.size());
+
+            for (Purchase* purchase : inPurchases)
+            {
+                result[getFingerprint(purchase)]++;
+            }
+
+            return result;
+        }
+
+        bool isDuplicate(
+            std::uint64_t inFingerprint,
+            const FingerprintCounts& inExisting,
+            FingerprintCounts& ioSeen
+        )
+        {
+            auto existing = inExisting.find(inFingerprint);
+
+            if (existing == inExisting.end())
+            {
+                return false;
+            }
+
+            return ++ioSeen[inFingerprint] <= existing->second;
+        }
+
+        QList<Purchase*> takeDuplicates(const FingerprintCounts& inExisting, QList<Purchase*>& ioCandidates)
+        {
+            QList<Purchase*> result {};
+            QList<Purchase*> candidates {};
+
+            FingerprintCounts seen {};
+
+            for (Purchase* purchase : ioCandidates)
+            {
+                if (isDuplicate(getFingerprint(purchase), inExisting, seen))
+                {
+                    result.push_back(purchase);
+
+                    continue;
+                }
+
+                candidates.push_back(purchase);
+            }
+
+            ioCandidates = candidates;
+
+            return result;
+        }
+    }
+}
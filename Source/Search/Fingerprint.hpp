@@ -0,0 +1,39 @@
+#pragma once
+
+#include <unordered_map>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Fingerprint -> how many purchases share it
+        using FingerprintCounts = std::unordered_map<std::uint64_t, std::uint32_t>;
+
+        // Content hash over date, normalized name, value in cents, installments and buyer
+        std::uint64_t getFingerprint(
+            const QDate& inDate,
+            const QString& inName,
+            float inValue,
+            std::uint32_t inInstallments,
+            std::uint32_t inUserId
+        );
+        std::uint64_t getFingerprint(Purchase* inPurchase);
+
+        FingerprintCounts countFingerprints(const QList<Purchase*>& inPurchases);
+
+        // Repeats are counted, so two identical charges only clash with two stored ones.
+        // Returns true when inFingerprint is already covered by inExisting, ioSeen tracks the incoming batch
+        bool isDuplicate(
+            std::uint64_t inFingerprint,
+            const FingerprintCounts& inExisting,
+            FingerprintCounts& ioSeen
+        );
+
+        // Moves the purchases already present in inExisting out of ioCandidates and returns them
+        QList<Purchase*> takeDuplicates(const FingerprintCounts& inExisting, QList<Purchase*>& ioCandidates);
+    }
+}
@@ -0,0 +1,463 @@
+#include "Search/Index.hpp"
+
+#include <algorithm>
+
+#include "Search/Text.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        constexpr float EXACT_WEIGHT  = 1.0f;
+        constexpr float PREFIX_WEIGHT = 0.75f;
+        constexpr float FUZZY_WEIGHT  = 0.5f;
+        constexpr float NAME_BOOST    = 2.0f;
+
+        void Index::add(Purchase* inPurchase)
+        {
+            if (inPurchase == nullptr)
+            {
+                return;
+            }
+
+            std::uint32_t id = inPurchase->getId();
+
+            remove(id);
+
+            // Ids mostly grow so the posting is usually already in place, otherwise it is rotated back
+            for (std::uint32_t termId : append(inPurchase).terms)
+            {
+                std::vector<Posting>& postings = m_postings[termId];
+
+                std::rotate(
+                    std::upper_bound(
+                        postings.begin(),
+                        postings.end() - 1,
+                        id,
+                        [](std::uint32_t a, const Posting& b) { return a < b.id; }
+                    ),
+                    postings.end() - 1,
+                    postings.end()
+                );
+            }
+        }
+
+        void Index::add(const QList<Purchase*>& inPurchases)
+        {
+            std::vector<Purchase*> purchases {};
+            std::unordered_set<std::uint32_t> ids {};
+
+            purchases.reserve(inPurchases.size());
+
+            // The last copy of an id wins, as with one add per purchase
+            for (auto iterator = inPurchases.rbegin(); iterator != inPurchases.rend(); iterator++)
+            {
+                if (*iterator == nullptr || !ids.insert((*iterator)->getId()).second)
+                {
+                    continue;
+                }
+
+                purchases.push_back(*iterator);
+            }
+
+            // Purchases indexed before leave every list they were in with one pass per list
+            std::unordered_set<std::uint32_t> touched {};
+
+            for (Purchase* purchase : purchases)
+            {
+                auto iterator = m_documents.find(purchase->getId());
+
+                if (iterator == m_documents.end())
+                {
+                    continue;
+                }
+
+                touched.insert(iterator->second.terms.begin(), iterator->second.terms.end());
+
+                m_documents.erase(iterator);
+            }
+
+            for (std::uint32_t termId : touched)
+            {
+                std::vector<Posting>& postings = m_postings[termId];
+
+                postings.erase(
+                    std::remove_if(
+                        postings.begin(),
+                        postings.end(),
+                        [&ids](const Posting& a) { return ids.find(a.id) != ids.end(); }
+                    ),
+                    postings.end()
+                );
+            }
+
+            // Append everything, then sort each touched list once instead of inserting in place
+            touched.clear();
+
+            for (Purchase* purchase : purchases)
+            {
+                for (std::uint32_t termId : append(purchase).terms)
+                {
+                    touched.insert(termId);
+                }
+            }
+
+            for (std::uint32_t termId : touched)
+            {
+                std::vector<Posting>& postings = m_postings[termId];
+
+                std::sort(
+                    postings.begin(),
+                    postings.end(),
+                    [](const Posting& a, const Posting& b) { return a.id < b.id; }
+                );
+            }
+        }
+
+        void Index::remove(std::uint32_t inId)
+        {
+            auto iterator = m_documents.find(inId);
+
+            if (iterator == m_documents.end())
+            {
+                return;
+            }
+
+            for (std::uint32_t termId : iterator->second.terms)
+            {
+                std::vector<Posting>& postings = m_postings[termId];
+
+                auto posting = std::lower_bound(
+                    postings.begin(),
+                    postings.end(),
+                    inId,
+                    [](const Posting& a, std::uint32_t b) { return a.id < b; }
+                );
+
+                if (posting == postings.end() || posting->id != inId)
+                {
+                    continue;
+                }
+
+                postings.erase(posting);
+            }
+
+            m_documents.erase(iterator);
+        }
+
+        void Index::removeAccount(std::uint32_t inAccountId)
+        {
+            std::vector<std::uint32_t> ids {};
+
+            for (auto& [id, document] : m_documents)
+            {
+                if (document.accountId != inAccountId)
+                {
+                    continue;
+                }
+
+                ids.push_back(id);
+            }
+
+            for (std::uint32_t id : ids)
+            {
+                remove(id);
+            }
+        }
+
+        void Index::clear()
+        {
+            m_documents.clear();
+            m_terms.clear();
+            m_termIds.clear();
+            m_postings.clear();
+            m_trigramCounts.clear();
+            m_trigrams.clear();
+        }
+
+        bool Index::contains(std::uint32_t inId) const
+        {
+            return m_documents.find(inId) != m_documents.end();
+        }
+
+        std::size_t Index::size() const
+        {
+            return m_documents.size();
+        }
+
+        std::vector<Hit> Index::search(const QString& inQuery, const Filter& inFilter) const
+        {
+            std::vector<std::unordered_map<std::uint32_t, float>> tokens {};
+
+            for (const QString& token : tokenize(inQuery))
+            {
+                tokens.push_back(expand(token));
+
+                // A term nothing matches empties the whole conjunction
+                if (tokens.back().empty())
+                {
+                    return {};
+                }
+            }
+
+            if (tokens.empty())
+            {
+                return {};
+            }
+
+            auto getCost = [this](const std::unordered_map<std::uint32_t, float>& inTerms)
+            {
+                std::size_t result = 0;
+
+                for (auto& [termId, weight] : inTerms)
+                {
+                    result += m_postings[termId].size();
+                }
+
+                return result;
+            };
+
+            // Start from the most selective token so the candidate set is small from the first pass
+            std::sort(
+                tokens.begin(),
+                tokens.end(),
+                [&getCost](const auto& a, const auto& b) { return getCost(a) < getCost(b); }
+            );
+
+            std::unordered_map<std::uint32_t, float> scores {};
+
+            for (auto& [termId, weight] : tokens[0])
+            {
+                for (const Posting& posting : m_postings[termId])
+                {
+                    if (!isAllowed(m_documents.at(posting.id), inFilter))
+                    {
+                        continue;
+                    }
+
+                    float score = weight * ((posting.fields & Field::Name) ? NAME_BOOST : 1.0f);
+                    float& best = scores[posting.id];
+
+                    best = std::max(best, score);
+                }
+            }
+
+            for (std::size_t i = 1; i < tokens.size() && !scores.empty(); i++)
+            {
+                std::unordered_map<std::uint32_t, float> tokenScores {};
+
+                for (auto& [termId, weight] : tokens[i])
+                {
+                    for (const Posting& posting : m_postings[termId])
+                    {
+                        if (scores.find(posting.id) == scores.end())
+                        {
+                            continue;
+                        }
+
+                        float score = weight * ((posting.fields & Field::Name) ? NAME_BOOST : 1.0f);
+                        float& best = tokenScores[posting.id];
+
+                        best = std::max(best, score);
+                    }
+                }
+
+                for (auto& [id, score] : tokenScores)
+                {
+                    score += scores[id];
+                }
+
+                scores = std::move(tokenScores);
+            }
+
+            std::vector<Hit> result {};
+            result.reserve(scores.size());
+
+            for (auto& [id, score] : scores)
+            {
+                result.push_back({ id, m_documents.at(id).accountId, score });
+            }
+
+            std::sort(
+                result.begin(),
+                result.end(),
+                [this](const Hit& a, const Hit& b)
+                {
+                    if (a.score != b.score)
+                    {
+                        return a.score > b.score;
+                    }
+
+                    std::int64_t dayA = m_documents.at(a.id).julianDay;
+                    std::int64_t dayB = m_documents.at(b.id).julianDay;
+
+                    return dayA != dayB ? dayA > dayB : a.id > b.id;
+                }
+            );
+
+            return result;
+        }
+
+        const Index::Document& Index::append(Purchase* inPurchase)
+        {
+            std::uint32_t id = inPurchase->getId();
+
+            std::map<std::uint32_t, std::uint8_t> fields {};
+
+            for (const QString& token : tokenize(inPurchase->getName()))
+            {
+                fields[getTermId(token)] |= Field::Name;
+            }
+
+            for (const QString& token : tokenize(inPurchase->getDescription()))
+            {
+                fields[getTermId(token)] |= Field::Description;
+            }
+
+            Document& document = m_documents[id];
+            document.accountId = inPurchase->getAccountId();
+            document.userId    = inPurchase->getUserId();
+            document.type      = (std::uint32_t) inPurchase->getType();
+            document.julianDay = inPurchase->getDate().toJulianDay();
+            document.terms.clear();
+            document.terms.reserve(fields.size());
+
+            for (auto& [termId, termFields] : fields)
+            {
+                m_postings[termId].push_back({ id, termFields });
+
+                document.terms.push_back(termId);
+            }
+
+            return document;
+        }
+
+        std::uint32_t Index::getTermId(const QString& inTerm)
+        {
+            auto iterator = m_termIds.find(inTerm);
+
+            if (iterator != m_termIds.end())
+            {
+                return iterator->second;
+            }
+
+            std::uint32_t termId = m_terms.size();
+
+            std::vector<std::uint64_t> trigrams = getTrigrams(inTerm);
+
+            m_terms.push_back(inTerm);
+            m_termIds[inTerm] = termId;
+            m_postings.push_back({});
+            m_trigramCounts.push_back(trigrams.size());
+
+            // Term ids only grow, so the lists stay sorted
+            for (std::uint64_t trigram : trigrams)
+            {
+                m_trigrams[trigram].push_back(termId);
+            }
+
+            return termId;
+        }
+
+        bool Index::isAllowed(const Document& inDocument, const Filter& inFilter) const
+        {
+            if (!inFilter.accounts.empty())
+            {
+                auto account = inFilter.accounts.find(inDocument.accountId);
+
+                if (account == inFilter.accounts.end())
+                {
+                    return false;
+                }
+
+                if (account->second >= 0 && inDocument.userId != (std::uint32_t) account->second)
+                {
+                    return false;
+                }
+            }
+
+            if (inFilter.userId >= 0 && inDocument.userId != (std::uint32_t) inFilter.userId)
+            {
+                return false;
+            }
+
+            if (inFilter.type >= 0 && inDocument.type != (std::uint32_t) inFilter.type)
+            {
+                return false;
+            }
+
+            return inDocument.julianDay >= inFilter.from && inDocument.julianDay <= inFilter.to;
+        }
+
+        std::unordered_map<std::uint32_t, float> Index::expand(const QString& inToken) const
+        {
+            std::unordered_map<std::uint32_t, float> result {};
+
+            auto setWeight = [this, &result](std::uint32_t inTermId, float inWeight)
+            {
+                if (m_postings[inTermId].empty())
+                {
+                    return;
+                }
+
+                float& weight = result[inTermId];
+
+                weight = std::max(weight, inWeight);
+            };
+
+            // Exact and prefix matches come straight out of the ordered vocabulary
+            std::uint32_t expanded = 0;
+
+            for (
+                auto iterator = m_termIds.lower_bound(inToken);
+                iterator != m_termIds.end() && iterator->first.startsWith(inToken) && expanded < MAX_EXPANSION;
+                iterator++, expanded++
+            )
+            {
+                setWeight(
+                    iterator->second,
+                    iterator->first.size() == inToken.size() ? EXACT_WEIGHT : PREFIX_WEIGHT
+                );
+            }
+
+            // Typos, scored by trigram similarity. Very short tokens would match almost anything
+            if (inToken.size() < 3)
+            {
+                return result;
+            }
+
+            std::vector<std::uint64_t> trigrams = getTrigrams(inToken);
+
+            std::unordered_map<std::uint32_t, std::uint32_t> shared {};
+
+            for (std::uint64_t trigram : trigrams)
+            {
+                auto iterator = m_trigrams.find(trigram);
+
+                if (iterator == m_trigrams.end())
+                {
+                    continue;
+                }
+
+                for (std::uint32_t termId : iterator->second)
+                {
+                    shared[termId]++;
+                }
+            }
+
+            for (auto& [termId, count] : shared)
+            {
+                float similarity = (float) count / (float) (trigrams.size() + m_trigramCounts[termId] - count);
+
+                if (similarity < MIN_SIMILARITY)
+                {
+                    continue;
+                }
+
+                setWeight(termId, FUZZY_WEIGHT * similarity);
+            }
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <limits>
+#include <map>
+#include <unordered_set>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        struct Filter
+        {
+            // Account id -> user id whose purchases are visible, -1 for everyone. Empty means any account
+            std::unordered_map<std::uint32_t, int> accounts = {};
+
+            int userId = -1;
+            int type   = -1;
+
+            // Julian days, inclusive
+            std::int64_t from = std::numeric_limits<std::int64_t>::min();
+            std::int64_t to   = std::numeric_limits<std::int64_t>::max();
+        };
+
+        struct Hit
+        {
+            std::uint32_t id        = 0;
+            std::uint32_t accountId = 0;
+            float score             = 0.0f;
+        };
+
+        // Inverted index over purchase names and descriptions, kept in sync by Account
+        class Index
+        {
+        public:
+            static constexpr float MIN_SIMILARITY       = 0.4f;
+            static constexpr std::uint32_t MAX_EXPANSION = 256;
+
+        public:
+            Index() = default;
+            ~Index() = default;
+
+        public:
+            void add(Purchase* inPurchase);
+            void add(const QList<Purchase*>& inPurchases);
+            void remove(std::uint32_t inId);
+            void removeAccount(std::uint32_t inAccountId);
+            void clear();
+
+            bool contains(std::uint32_t inId) const;
+            std::size_t size() const;
+
+            // Every query term has to match, ranked by score then by most recent
+            std::vector<Hit> search(const QString& inQuery, const Filter& inFilter) const;
+
+        private:
+            enum Field : std::uint8_t
+            {
+                Name        = 1 << 0,
+                Description = 1 << 1
+            };
+
+            struct Posting
+            {
+                std::uint32_t id;
+                std::uint8_t fields;
+            };
+
+            struct Document
+            {
+                std::uint32_t accountId;
+                std::uint32_t userId;
+                std::uint32_t type;
+                std::int64_t julianDay;
+
+                std::vector<std::uint32_t> terms;
+            };
+
+        private:
+            // Indexes inPurchase, its postings are appended at the end of their lists
+            const Document& append(Purchase* inPurchase);
+
+            std::uint32_t getTermId(const QString& inTerm);
+
+            bool isAllowed(const Document& inDocument, const Filter& inFilter) const;
+
+            // Term id -> weight of the match against a single query token
+            std::unordered_map<std::uint32_t, float> expand(const QString& inToken) const;
+
+        private:
+            std::unordered_map<std::uint32_t, Document> m_documents;
+
+            std::vector<QString> m_terms;
+            std::map<QString, std::uint32_t> m_termIds; // Ordered for prefix scans
+            std::vector<std::vector<Posting>> m_postings; // Sorted by purchase id
+            std::vector<std::uint32_t> m_trigramCounts;
+
+            std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> m_trigrams; // Trigram -> term ids
+        };
+    }
+}
@@ -0,0 +1,77 @@
+#include "Search/Query.hpp"
+
+#include <algorithm>
+
+namespace Financy
+{
+    namespace Search
+    {
+        bool hasAccount(const Query& inQuery, std::uint32_t inAccountId)
+        {
+            return inQuery.accountIds.empty() || std::find(
+                inQuery.accountIds.begin(),
+                inQuery.accountIds.end(),
+                inAccountId
+            ) != inQuery.accountIds.end();
+        }
+
+        bool matches(Purchase* inPurchase, const Query& inQuery)
+        {
+            if (inPurchase == nullptr)
+            {
+                return false;
+            }
+
+            std::int64_t day = inPurchase->getDate().toJulianDay();
+
+            if (day < inQuery.from || day > inQuery.to)
+            {
+                return false;
+            }
+
+            if (inQuery.userId >= 0 && inPurchase->getUserId() != (std::uint32_t) inQuery.userId)
+            {
+                return false;
+            }
+
+            if (
+                !inQuery.types.empty() &&
+                std::find(inQuery.types.begin(), inQuery.types.end(), inPurchase->getType()) == inQuery.types.end()
+            )
+            {
+                return false;
+            }
+
+            if (inPurchase->getValue() < inQuery.minValue || inPurchase->getValue() > inQuery.maxValue)
+            {
+                return false;
+            }
+
+            bool isRecurring = inPurchase->isRecurring();
+
+            if (
+                (inQuery.recurrence == Query::Recurrence::Only && !isRecurring) ||
+                (inQuery.recurrence == Query::Recurrence::Exclude && isRecurring)
+            )
+            {
+                return false;
+            }
+
+            if (!inQuery.statementDate.isValid())
+            {
+                return true;
+            }
+
+            // Checked last, it walks the statement days
+            std::uint32_t paidInstallments = inPurchase->getPaidInstallments(
+                inQuery.statementDate,
+                inQuery.statementClosingDay
+            );
+
+            bool isPast   = paidInstallments <= 0;
+            bool isFuture = (isRecurring && !inPurchase->hasEnded()) ? false : paidInstallments > inPurchase->getInstallments();
+
+            return !isPast && !isFuture;
+        }
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Conjunction of predicates over purchases, unset fields match everything
+        struct Query
+        {
+            enum class Recurrence
+            {
+                Any = 0,
+                Only,
+                Exclude
+            };
+
+            // Purchase date as Julian days, inclusive
+            std::int64_t from = std::numeric_limits<std::int64_t>::min();
+            std::int64_t to   = std::numeric_limits<std::int64_t>::max();
+
+            // Only purchases with an installment due in the statement closing on this date
+            QDate statementDate                = QDate();
+            std::uint32_t statementClosingDay  = 0;
+
+            std::vector<Purchase::Type> types = {};
+
+            float minValue = std::numeric_limits<float>::lowest();
+            float maxValue = std::numeric_limits<float>::max();
+
+            int userId = -1;
+
+            // Only read by callers running the query over several accounts
+            std::vector<std::uint32_t> accountIds = {};
+
+            Recurrence recurrence = Recurrence::Any;
+
+            bool isDescending = false;
+        };
+
+        bool hasAccount(const Query& inQuery, std::uint32_t inAccountId);
+        bool matches(Purchase* inPurchase, const Query& inQuery);
+    }
+}
@@ -0,0 +1,175 @@
+#include "Search/Rollup.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Financy
+{
+    namespace Search
+    {
+        Rollup::Rollup(std::uint32_t inClosingDay)
+            : m_closingDay(inClosingDay),
+            m_installmentChanges({}),
+            m_recurringChanges({}),
+            m_openRecurringChanges({})
+        {}
+
+        int Rollup::getStatementIndex(const QDate& inDate, std::uint32_t inClosingDay)
+        {
+            int result = inDate.year() * 12 + inDate.month() - 1;
+
+            std::uint32_t closingDay = std::min(
+                inClosingDay,
+                (std::uint32_t) inDate.daysInMonth()
+            );
+
+            return (std::uint32_t) inDate.day() < closingDay ? result - 1 : result;
+        }
+
+        void Rollup::add(Purchase* inPurchase)
+        {
+            if (inPurchase == nullptr)
+            {
+                return;
+            }
+
+            apply(inPurchase->toData(), 1.0f);
+        }
+
+        void Rollup::add(const PurchaseData& inPurchase)
+        {
+            apply(inPurchase, 1.0f);
+        }
+
+        void Rollup::remove(Purchase* inPurchase)
+        {
+            if (inPurchase == nullptr)
+            {
+                return;
+            }
+
+            apply(inPurchase->toData(), -1.0f);
+        }
+
+        int Rollup::getFirstIndex() const
+        {
+            int result = std::numeric_limits<int>::max();
+
+            if (!m_installmentChanges.empty())
+            {
+                result = std::min(result, m_installmentChanges.begin()->first);
+            }
+
+            if (!m_recurringChanges.empty())
+            {
+                result = std::min(result, m_recurringChanges.begin()->first);
+            }
+
+            if (!m_openRecurringChanges.empty())
+            {
+                result = std::min(result, m_openRecurringChanges.begin()->first);
+            }
+
+            return result;
+        }
+
+        int Rollup::getLastIndex() const
+        {
+            int result = std::numeric_limits<int>::min();
+
+            // The last change is where the value drops back out, one past the last due statement
+            if (!m_installmentChanges.empty())
+            {
+                result = std::max(result, m_installmentChanges.rbegin()->first - 1);
+            }
+
+            if (!m_recurringChanges.empty())
+            {
+                result = std::max(result, m_recurringChanges.rbegin()->first - 1);
+            }
+
+            return result;
+        }
+
+        void Rollup::apply(const PurchaseData& inPurchase, float inSign)
+        {
+            float value = inPurchase.getInstallmentValue() * inSign;
+
+            int first = getStatementIndex(inPurchase.date, m_closingDay);
+
+            // Mirrors Purchase::getPaidInstallments, statement S is due when 1 <= S - first + 1 <= installments
+            if (inPurchase.isRecurring() && !inPurchase.hasEnded)
+            {
+                addChange(m_openRecurringChanges, first, value);
+
+                return;
+            }
+
+            addRange(
+                inPurchase.isRecurring() ? m_recurringChanges : m_installmentChanges,
+                first,
+                inPurchase.getInstallments(),
+                value
+            );
+        }
+
+        Rollup::Totals Rollup::get(int inStatementIndex) const
+        {
+            return get(inStatementIndex, 1)[0];
+        }
+
+        std::vector<Rollup::Totals> Rollup::get(int inStatementIndex, std::uint32_t inCount) const
+        {
+            std::vector<Totals> result(inCount);
+
+            auto accumulate = [&](const std::map<int, float>& inChanges, float Totals::* inField)
+            {
+                float running = 0.0f;
+
+                auto iterator = inChanges.begin();
+
+                for (std::uint32_t i = 0; i < inCount; i++)
+                {
+                    for (; iterator != inChanges.end() && iterator->first <= inStatementIndex + (int) i; iterator++)
+                    {
+                        running += iterator->second;
+                    }
+
+                    // Float drift from adding and removing the same values
+                    result[i].*inField += std::abs(running) < 0.005f ? 0.0f : running;
+                }
+            };
+
+            accumulate(m_installmentChanges,   &Totals::installments);
+            accumulate(m_recurringChanges,     &Totals::recurring);
+            accumulate(m_openRecurringChanges, &Totals::recurring);
+
+            return result;
+        }
+
+        void Rollup::addRange(std::map<int, float>& ioChanges, int inFirst, std::uint32_t inCount, float inValue)
+        {
+            if (inCount == 0)
+            {
+                return;
+            }
+
+            addChange(ioChanges, inFirst,                  inValue);
+            addChange(ioChanges, inFirst + (int) inCount, -inValue);
+        }
+
+        void Rollup::addChange(std::map<int, float>& ioChanges, int inIndex, float inValue)
+        {
+            float& change = ioChanges[inIndex];
+
+            change += inValue;
+
+            // Drop cancelled entries so the first and last indices follow removals
+            if (std::abs(change) < 0.005f)
+            {
+                ioChanges.erase(inIndex);
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Per statement totals of one account as a difference array over statement months,
+        // adding a purchase is O(log n) and reading N consecutive statements is O(N)
+        class Rollup
+        {
+        public:
+            struct Totals
+            {
+                float installments = 0.0f;
+                float recurring    = 0.0f;
+            };
+
+        public:
+            Rollup(std::uint32_t inClosingDay);
+            ~Rollup() = default;
+
+        public:
+            // Month (year * 12 + month) of the last statement closing on or before inDate
+            static int getStatementIndex(const QDate& inDate, std::uint32_t inClosingDay);
+
+        public:
+            void add(Purchase* inPurchase);
+            void add(const PurchaseData& inPurchase);
+            void remove(Purchase* inPurchase);
+
+            // First statement with any value due, open recurring purchases included
+            int getFirstIndex() const;
+
+            // Last statement of every bounded value, open recurring purchases never drop out
+            int getLastIndex() const;
+
+            Totals get(int inStatementIndex) const;
+            std::vector<Totals> get(int inStatementIndex, std::uint32_t inCount) const;
+
+        private:
+            void apply(const PurchaseData& inPurchase, float inSign);
+            void addRange(std::map<int, float>& ioChanges, int inFirst, std::uint32_t inCount, float inValue);
+            void addChange(std::map<int, float>& ioChanges, int inIndex, float inValue);
+
+        private:
+            std::uint32_t m_closingDay;
+
+            std::map<int, float> m_installmentChanges;
+            std::map<int, float> m_recurringChanges;
+
+            // Recurring purchases without an end are due from their first statement onwards
+            std::map<int, float> m_openRecurringChanges;
+        };
+    }
+}
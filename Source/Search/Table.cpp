@@ -0,0 +1,274 @@
+#include "Search/Table.hpp"
+
+#include <algorithm>
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Longest possible month, used to turn statement months into day bounds
+        constexpr std::int64_t MONTH_DAYS = 31;
+
+        Table::Table()
+            : m_isDirty(true),
+            m_purchases({}),
+            m_days({}),
+            m_types({}),
+            m_users({}),
+            m_recurring({}),
+            m_fingerprints({}),
+            m_maxInstallments(1)
+        {}
+
+        void Table::rebuild(const QList<Purchase*>& inPurchases)
+        {
+            m_purchases.assign(inPurchases.begin(), inPurchases.end());
+
+            std::stable_sort(
+                m_purchases.begin(),
+                m_purchases.end(),
+                [](Purchase* a, Purchase* b) { return a->getDate().toJulianDay() < b->getDate().toJulianDay(); }
+            );
+
+            m_days.clear();
+            m_users.clear();
+            m_recurring.clear();
+            m_fingerprints.clear();
+            m_maxInstallments = 1;
+
+            for (std::vector<std::uint32_t>& positions : m_types)
+            {
+                positions.clear();
+            }
+
+            m_days.reserve(m_purchases.size());
+
+            for (std::uint32_t i = 0; i < m_purchases.size(); i++)
+            {
+                Purchase* purchase = m_purchases[i];
+
+                m_days.push_back(purchase->getDate().toJulianDay());
+
+                std::size_t type = std::min((std::size_t) purchase->getType(), TYPE_COUNT - 1);
+
+                m_types[type].push_back(i);
+                m_users[purchase->getUserId()].push_back(i);
+                m_fingerprints[getFingerprint(purchase)]++;
+
+                if (purchase->isRecurring())
+                {
+                    m_recurring.push_back(i);
+
+                    continue;
+                }
+
+                m_maxInstallments = std::max(m_maxInstallments, purchase->getInstallments());
+            }
+
+            m_isDirty = false;
+        }
+
+        void Table::invalidate()
+        {
+            m_isDirty = true;
+        }
+
+        bool Table::isDirty() const
+        {
+            return m_isDirty;
+        }
+
+        void Table::select(const Query& inQuery, const std::function<void(Purchase*)>& inCallback) const
+        {
+            std::vector<std::uint32_t> positions = plan(inQuery);
+
+            if (inQuery.isDescending)
+            {
+                std::reverse(positions.begin(), positions.end());
+            }
+
+            for (std::uint32_t position : positions)
+            {
+                Purchase* purchase = m_purchases[position];
+
+                if (!matches(purchase, inQuery))
+                {
+                    continue;
+                }
+
+                inCallback(purchase);
+            }
+        }
+
+        QList<Purchase*> Table::select(const Query& inQuery) const
+        {
+            QList<Purchase*> result {};
+
+            select(
+                inQuery,
+                [&result](Purchase* inPurchase) { result.push_back(inPurchase); }
+            );
+
+            return result;
+        }
+
+        const FingerprintCounts& Table::getFingerprints() const
+        {
+            return m_fingerprints;
+        }
+
+        std::vector<std::uint32_t> Table::plan(const Query& inQuery) const
+        {
+            auto getPosition = [this](std::int64_t inDay)
+            {
+                return (std::uint32_t) (std::lower_bound(m_days.begin(), m_days.end(), inDay) - m_days.begin());
+            };
+
+            auto getRange = [](const std::vector<std::uint32_t>& inPositions, std::uint32_t inBegin, std::uint32_t inEnd)
+            {
+                return std::make_pair(
+                    std::lower_bound(inPositions.begin(), inPositions.end(), inBegin),
+                    std::lower_bound(inPositions.begin(), inPositions.end(), inEnd)
+                );
+            };
+
+            // Date range every candidate has to fall in
+            std::int64_t from = inQuery.from;
+            std::int64_t to   = inQuery.to;
+
+            // Non recurring purchases can only be due for so many months after being made
+            std::int64_t installmentFrom = from;
+
+            if (inQuery.statementDate.isValid())
+            {
+                std::int64_t statementDay = inQuery.statementDate.toJulianDay();
+
+                to              = std::min(to, statementDay + MONTH_DAYS);
+                installmentFrom = std::max(
+                    from,
+                    statementDay - ((std::int64_t) m_maxInstallments + 1) * MONTH_DAYS
+                );
+            }
+
+            if (from > to || m_purchases.empty())
+            {
+                return {};
+            }
+
+            std::uint32_t begin            = getPosition(from);
+            std::uint32_t installmentBegin = getPosition(installmentFrom);
+            std::uint32_t end              = to == std::numeric_limits<std::int64_t>::max() ?
+                (std::uint32_t) m_purchases.size() :
+                getPosition(to + 1);
+
+            installmentBegin = std::min(installmentBegin, end);
+
+            auto recurring = getRange(m_recurring, begin, end);
+
+            std::size_t recurringCost = recurring.second - recurring.first;
+            std::size_t dateCost      = 0;
+
+            switch (inQuery.recurrence)
+            {
+            case Query::Recurrence::Only:
+                dateCost = recurringCost;
+
+                break;
+
+            case Query::Recurrence::Exclude:
+                dateCost = end - installmentBegin;
+
+                break;
+
+            default:
+                dateCost = (end - installmentBegin) + recurringCost;
+
+                break;
+            }
+
+            std::size_t typeCost = std::numeric_limits<std::size_t>::max();
+
+            if (!inQuery.types.empty())
+            {
+                typeCost = 0;
+
+                for (Purchase::Type type : inQuery.types)
+                {
+                    auto range = getRange(m_types[std::min((std::size_t) type, TYPE_COUNT - 1)], begin, end);
+
+                    typeCost += range.second - range.first;
+                }
+            }
+
+            std::size_t userCost = std::numeric_limits<std::size_t>::max();
+            auto user            = m_users.find(inQuery.userId >= 0 ? (std::uint32_t) inQuery.userId : 0);
+
+            if (inQuery.userId >= 0)
+            {
+                if (user == m_users.end())
+                {
+                    return {};
+                }
+
+                auto range = getRange(user->second, begin, end);
+
+                userCost = range.second - range.first;
+            }
+
+            std::vector<std::uint32_t> result {};
+
+            // Walk whichever index yields the fewest candidates, the remaining predicates are checked per row
+            if (userCost <= typeCost && userCost <= dateCost)
+            {
+                auto range = getRange(user->second, begin, end);
+
+                result.assign(range.first, range.second);
+
+                return result;
+            }
+
+            if (typeCost <= dateCost)
+            {
+                for (Purchase::Type type : inQuery.types)
+                {
+                    auto range = getRange(m_types[std::min((std::size_t) type, TYPE_COUNT - 1)], begin, end);
+
+                    result.insert(result.end(), range.first, range.second);
+                }
+
+                std::sort(result.begin(), result.end());
+                result.erase(std::unique(result.begin(), result.end()), result.end());
+
+                return result;
+            }
+
+            result.reserve(dateCost);
+
+            if (inQuery.recurrence != Query::Recurrence::Exclude)
+            {
+                result.assign(recurring.first, recurring.second);
+            }
+
+            if (inQuery.recurrence == Query::Recurrence::Only)
+            {
+                return result;
+            }
+
+            std::size_t recurringCount = result.size();
+
+            for (std::uint32_t i = installmentBegin; i < end; i++)
+            {
+                if (m_purchases[i]->isRecurring())
+                {
+                    continue;
+                }
+
+                result.push_back(i);
+            }
+
+            std::inplace_merge(result.begin(), result.begin() + recurringCount, result.end());
+
+            return result;
+        }
+    }
+}
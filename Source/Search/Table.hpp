@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <QtCore>
+
+#include "Search/Fingerprint.hpp"
+#include "Search/Query.hpp"
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Secondary indexes over one account's purchases, rebuilt lazily after the account changes
+        class Table
+        {
+        public:
+            static constexpr std::size_t TYPE_COUNT = (std::size_t) Purchase::Type::Other + 1;
+
+        public:
+            Table();
+            ~Table() = default;
+
+        public:
+            void rebuild(const QList<Purchase*>& inPurchases);
+            void invalidate();
+            bool isDirty() const;
+
+            // Streams matches in date order, most recent first when the query asks for it
+            void select(const Query& inQuery, const std::function<void(Purchase*)>& inCallback) const;
+            QList<Purchase*> select(const Query& inQuery) const;
+
+            const FingerprintCounts& getFingerprints() const;
+
+        private:
+            // Positions into m_purchases, ascending
+            std::vector<std::uint32_t> plan(const Query& inQuery) const;
+
+        private:
+            bool m_isDirty;
+
+            // Sorted by date
+            std::vector<Purchase*> m_purchases;
+            std::vector<std::int64_t> m_days;
+
+            std::array<std::vector<std::uint32_t>, TYPE_COUNT> m_types;
+            std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_users;
+            std::vector<std::uint32_t> m_recurring;
+
+            FingerprintCounts m_fingerprints;
+
+            // Bounds how far back a non recurring purchase can still be due
+            std::uint32_t m_maxInstallments;
+        };
+    }
+}
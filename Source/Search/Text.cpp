@@ -0,0 +1,81 @@
+#include "Search/Text.hpp"
+
+#include <algorithm>
+
+namespace Financy
+{
+    namespace Search
+    {
+        QString fold(const QString& inText)
+        {
+            QString decomposed = inText.normalized(QString::NormalizationForm_KD);
+
+            QString result;
+            result.reserve(decomposed.size());
+
+            for (const QChar& character : decomposed)
+            {
+                if (character.category() == QChar::Mark_NonSpacing)
+                {
+                    continue;
+                }
+
+                result.append(character);
+            }
+
+            return result.toCaseFolded();
+        }
+
+        std::vector<QString> tokenize(const QString& inText)
+        {
+            QString folded = fold(inText);
+
+            std::vector<QString> result {};
+
+            qsizetype start = -1;
+
+            for (qsizetype i = 0; i <= folded.size(); i++)
+            {
+                bool isWord = i < folded.size() && folded[i].isLetterOrNumber();
+
+                if (isWord && start < 0)
+                {
+                    start = i;
+                }
+
+                if (isWord || start < 0)
+                {
+                    continue;
+                }
+
+                result.push_back(folded.mid(start, i - start));
+
+                start = -1;
+            }
+
+            return result;
+        }
+
+        std::vector<std::uint64_t> getTrigrams(const QString& inTerm)
+        {
+            QString padded = "  " + inTerm + " ";
+
+            std::vector<std::uint64_t> result {};
+            result.reserve(padded.size() - 2);
+
+            for (qsizetype i = 0; i + 2 < padded.size(); i++)
+            {
+                result.push_back(
+                    ((std::uint64_t) padded[i].unicode() << 32) |
+                    ((std::uint64_t) padded[i + 1].unicode() << 16) |
+                    (std::uint64_t) padded[i + 2].unicode()
+                );
+            }
+
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <vector>
+
+#include <QtCore>
+
+namespace Financy
+{
+    namespace Search
+    {
+        // Lowercased, accent free text so "Café" and "cafe" land on the same term
+        QString fold(const QString& inText);
+
+        std::vector<QString> tokenize(const QString& inText);
+
+        // Padded like pg_trgm ("  ab "), so short terms still produce trigrams
+        std::vector<std::uint64_t> getTrigrams(const QString& inTerm);
+    }
+}
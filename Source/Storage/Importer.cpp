@@ -0,0 +1,592 @@
+#include "Storage/Importer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include <QRegularExpression>
+
+#include "Base.hpp"
+#include "Search/Text.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        namespace Import
+        {
+            enum class Column
+            {
+                None = 0,
+                Date,
+                Name,
+                Description,
+                Value,
+                Installments,
+                Type
+            };
+
+            // Folded header prefixes, English and Portuguese exports
+            const std::vector<std::pair<Column, std::vector<QString>>> COLUMN_ALIASES = {
+                { Column::Date,         { "date", "data", "posted", "transaction date", "dt" } },
+                { Column::Name,         { "title", "titulo", "name", "nome", "payee", "merchant", "estabelecimento", "lancamento", "historico" } },
+                { Column::Description,  { "description", "descricao", "memo", "notes", "observacao", "details", "detalhes" } },
+                { Column::Value,        { "amount", "value", "valor", "total", "debit", "debito" } },
+                { Column::Installments, { "installment", "parcela" } },
+                { Column::Type,         { "category", "categoria", "type", "tipo" } }
+            };
+
+            Column getColumn(const QString& inHeader)
+            {
+                QString header = Search::fold(inHeader).trimmed();
+
+                for (auto& [column, aliases] : COLUMN_ALIASES)
+                {
+                    for (const QString& alias : aliases)
+                    {
+                        if (header.startsWith(alias))
+                        {
+                            return column;
+                        }
+                    }
+                }
+
+                return Column::None;
+            }
+
+            char getDelimiter(const std::string& inLine)
+            {
+                const char delimiters[] = { ',', ';', '\t', '|' };
+
+                char result          = ',';
+                std::size_t maxCount = 0;
+
+                for (char delimiter : delimiters)
+                {
+                    std::size_t count = 0;
+                    bool isQuoted     = false;
+
+                    for (char character : inLine)
+                    {
+                        if (character == '"')
+                        {
+                            isQuoted = !isQuoted;
+                        }
+
+                        if (!isQuoted && character == delimiter)
+                        {
+                            count++;
+                        }
+                    }
+
+                    if (count <= maxCount)
+                    {
+                        continue;
+                    }
+
+                    result   = delimiter;
+                    maxCount = count;
+                }
+
+                return result;
+            }
+
+            // Exports are UTF-8, or Latin-1 from older bank systems when the bytes aren't valid UTF-8
+            QString decodeText(const std::string& inText)
+            {
+                QString result = QString::fromUtf8(inText);
+
+                if (!result.contains(QChar::ReplacementCharacter))
+                {
+                    return result;
+                }
+
+                return QString::fromLatin1(inText);
+            }
+
+            // Returns false while a quoted field is still open and the record continues on the next line
+            bool splitRecord(const std::string& inRecord, char inDelimiter, std::vector<QString>& outFields)
+            {
+                outFields.clear();
+
+                std::string field;
+                bool isQuoted = false;
+
+                for (std::size_t i = 0; i < inRecord.size(); i++)
+                {
+                    char character = inRecord[i];
+
+                    if (character == '"')
+                    {
+                        if (isQuoted && i + 1 < inRecord.size() && inRecord[i + 1] == '"')
+                        {
+                            field.push_back('"');
+                            i++;
+
+                            continue;
+                        }
+
+                        isQuoted = !isQuoted;
+
+                        continue;
+                    }
+
+                    if (!isQuoted && character == inDelimiter)
+                    {
+                        outFields.push_back(decodeText(field).trimmed());
+                        field.clear();
+
+                        continue;
+                    }
+
+                    if (!isQuoted && character == '\r')
+                    {
+                        continue;
+                    }
+
+                    field.push_back(character);
+                }
+
+                if (isQuoted)
+                {
+                    return false;
+                }
+
+                outFields.push_back(decodeText(field).trimmed());
+
+                return true;
+            }
+
+            QString decodeEntities(QString inText)
+            {
+                return inText
+                    .replace("&lt;",   "<")
+                    .replace("&gt;",   ">")
+                    .replace("&quot;", "\"")
+                    .replace("&apos;", "'")
+                    .replace("&amp;",  "&");
+            }
+
+            Format getFormat(const std::string& inFilepath)
+            {
+                QString extension = QFileInfo(QString::fromStdString(inFilepath)).suffix().toLower();
+
+                if (extension == "csv" || extension == "txt")
+                {
+                    return Format::CSV;
+                }
+
+                if (extension == "ofx" || extension == "qfx")
+                {
+                    return Format::OFX;
+                }
+
+                std::ifstream file(inFilepath, std::ios::binary);
+
+                if (!file.is_open())
+                {
+                    return Format::Unknown;
+                }
+
+                std::string head(512, '\0');
+                file.read(head.data(), head.size());
+                head.resize(file.gcount());
+
+                if (head.find("OFXHEADER") != std::string::npos || head.find("<OFX>") != std::string::npos)
+                {
+                    return Format::OFX;
+                }
+
+                return Format::CSV;
+            }
+
+            void readCSV(std::istream& inStream, const std::function<void(Row&)>& inCallback)
+            {
+                std::string line;
+
+                if (!std::getline(inStream, line))
+                {
+                    return;
+                }
+
+                // UTF-8 byte order mark
+                if (line.rfind("\xEF\xBB\xBF", 0) == 0)
+                {
+                    line.erase(0, 3);
+                }
+
+                char delimiter = getDelimiter(line);
+
+                std::vector<QString> fields {};
+                splitRecord(line, delimiter, fields);
+
+                std::vector<Column> columns {};
+                bool hasName = false;
+
+                for (const QString& field : fields)
+                {
+                    Column column = getColumn(field);
+
+                    // Columns only map once, the first match wins
+                    if (column != Column::None && std::find(columns.begin(), columns.end(), column) != columns.end())
+                    {
+                        column = Column::None;
+                    }
+
+                    hasName = hasName || column == Column::Name;
+
+                    columns.push_back(column);
+                }
+
+                // Many exports only have a description column, which is the purchase name
+                if (!hasName)
+                {
+                    std::replace(columns.begin(), columns.end(), Column::Description, Column::Name);
+                }
+
+                if (
+                    std::find(columns.begin(), columns.end(), Column::Date) == columns.end() ||
+                    std::find(columns.begin(), columns.end(), Column::Value) == columns.end()
+                )
+                {
+                    return;
+                }
+
+                std::string record;
+
+                while (std::getline(inStream, line))
+                {
+                    record.append(line);
+
+                    if (!splitRecord(record, delimiter, fields))
+                    {
+                        record.push_back('\n');
+
+                        continue;
+                    }
+
+                    record.clear();
+
+                    Row row;
+
+                    for (std::size_t i = 0; i < fields.size() && i < columns.size(); i++)
+                    {
+                        switch (columns[i])
+                        {
+                        case Column::Date:
+                            row.date = parseDate(fields[i]);
+
+                            break;
+
+                        case Column::Name:
+                            row.name = fields[i];
+
+                            break;
+
+                        case Column::Description:
+                            row.description = fields[i];
+
+                            break;
+
+                        case Column::Value:
+                            row.value = parseValue(fields[i]);
+
+                            break;
+
+                        case Column::Installments:
+                        {
+                            QString cell = fields[i];
+
+                            std::uint32_t number = 1;
+                            std::uint32_t count  = fields[i].toUInt();
+
+                            if (parseInstallment(cell, number, count))
+                            {
+                                row.installment = number;
+                            }
+
+                            row.installments = std::max(count, (std::uint32_t) 1);
+
+                            break;
+                        }
+
+                        case Column::Type:
+                            row.type = Purchase::getTypeValue(fields[i]);
+
+                            break;
+
+                        default:
+                            break;
+                        }
+                    }
+
+                    if (!row.date.isValid() || (row.name.isEmpty() && row.description.isEmpty()))
+                    {
+                        continue;
+                    }
+
+                    inCallback(row);
+                }
+            }
+
+            void readOFX(std::istream& inStream, const std::function<void(Row&)>& inCallback)
+            {
+                // OFX 1.x is SGML with optional closing tags, so split on tags rather than lines
+                std::string chunk;
+
+                bool isTransaction = false;
+                Row row;
+
+                while (std::getline(inStream, chunk, '<'))
+                {
+                    std::size_t end = chunk.find('>');
+
+                    if (end == std::string::npos)
+                    {
+                        continue;
+                    }
+
+                    std::string tag = chunk.substr(0, end);
+                    QString value   = decodeEntities(decodeText(chunk.substr(end + 1)).trimmed());
+
+                    if (tag == "STMTTRN")
+                    {
+                        isTransaction = true;
+                        row           = {};
+
+                        continue;
+                    }
+
+                    if (tag == "/STMTTRN")
+                    {
+                        isTransaction = false;
+
+                        if (row.name.isEmpty())
+                        {
+                            std::swap(row.name, row.description);
+                        }
+
+                        if (!row.date.isValid() || row.name.isEmpty())
+                        {
+                            continue;
+                        }
+
+                        inCallback(row);
+
+                        continue;
+                    }
+
+                    if (!isTransaction)
+                    {
+                        continue;
+                    }
+
+                    if (tag == "DTPOSTED")
+                    {
+                        row.date = QDate::fromString(value.left(8), "yyyyMMdd");
+                    }
+                    else if (tag == "TRNAMT")
+                    {
+                        row.value = parseValue(value);
+                    }
+                    else if (tag == "NAME" || (tag == "PAYEE" && row.name.isEmpty()))
+                    {
+                        row.name = value;
+                    }
+                    else if (tag == "MEMO")
+                    {
+                        row.description = value;
+                    }
+                }
+            }
+
+            bool parseInstallment(QString& ioName, std::uint32_t& outNumber, std::uint32_t& outCount)
+            {
+                static const QRegularExpression expression(
+                    "^(.*?)[\\s\\-]*(?:parc(?:ela)?\\.?\\s*)?(\\d{1,3})\\s*/\\s*(\\d{1,3})\\s*$",
+                    QRegularExpression::CaseInsensitiveOption
+                );
+
+                QRegularExpressionMatch match = expression.match(ioName);
+
+                if (!match.hasMatch())
+                {
+                    return false;
+                }
+
+                std::uint32_t number = match.captured(2).toUInt();
+                std::uint32_t count  = match.captured(3).toUInt();
+
+                if (number < 1 || count < 2 || number > count || count > MAX_INSTALLMENT_COUNT)
+                {
+                    return false;
+                }
+
+                ioName    = match.captured(1).trimmed();
+                outNumber = number;
+                outCount  = count;
+
+                return true;
+            }
+
+            QDate parseDate(const QString& inDate)
+            {
+                const char* formats[] = { "dd/MM/yyyy", "yyyy-MM-dd", "dd-MM-yyyy", "dd.MM.yyyy", "dd/MM/yy", "yyyyMMdd" };
+
+                // Only the date part of timestamps
+                QString date = inDate.section(' ', 0, 0).section('T', 0, 0);
+
+                for (const char* format : formats)
+                {
+                    QDate result = QDate::fromString(date, format);
+
+                    if (!result.isValid())
+                    {
+                        continue;
+                    }
+
+                    // Two digit years land in 19xx
+                    if (result.year() < 1970)
+                    {
+                        result = result.addYears(100);
+                    }
+
+                    return result;
+                }
+
+                return QDate();
+            }
+
+            float parseValue(const QString& inValue)
+            {
+                QString value;
+
+                for (const QChar& character : inValue)
+                {
+                    if (character.isDigit() || character == ',' || character == '.' || character == '-')
+                    {
+                        value.append(character);
+                    }
+                }
+
+                // Accounting style negatives
+                if (inValue.contains('(') && inValue.contains(')') && !value.startsWith('-'))
+                {
+                    value.prepend('-');
+                }
+
+                qsizetype comma = value.lastIndexOf(',');
+                qsizetype dot   = value.lastIndexOf('.');
+
+                // Whichever separator comes last is the decimal one, a lone comma only when followed by cents
+                bool isCommaDecimal = comma > dot && (dot >= 0 || value.size() - comma - 1 <= 2);
+
+                if (isCommaDecimal)
+                {
+                    value.remove('.');
+                    value.replace(',', '.');
+                }
+                else
+                {
+                    value.remove(',');
+                }
+
+                return value.toFloat();
+            }
+
+            std::vector<Row> read(const std::string& inFilepath)
+            {
+                Format format = getFormat(inFilepath);
+
+                std::ifstream file(inFilepath, std::ios::binary);
+
+                if (format == Format::Unknown || !file.is_open())
+                {
+                    return {};
+                }
+
+                std::vector<Row> rows {};
+                std::size_t negativeCount = 0;
+
+                auto collect = [&rows, &negativeCount](Row& inRow)
+                {
+                    if (inRow.value == 0.0f)
+                    {
+                        return;
+                    }
+
+                    negativeCount += inRow.value < 0.0f ? 1 : 0;
+
+                    rows.push_back(std::move(inRow));
+                };
+
+                if (format == Format::OFX)
+                {
+                    readOFX(file, collect);
+                }
+                else
+                {
+                    readCSV(file, collect);
+                }
+
+                // OFX debits are negative. CSV exports differ, charges are whichever sign most rows have
+                bool isChargeNegative = format == Format::OFX || negativeCount * 2 > rows.size();
+
+                std::vector<Row> result {};
+                result.reserve(rows.size());
+
+                QSet<QString> keys {};
+
+                for (Row& row : rows)
+                {
+                    if ((row.value < 0.0f) != isChargeNegative)
+                    {
+                        continue;
+                    }
+
+                    row.value = std::abs(row.value);
+
+                    if (row.installments <= 1)
+                    {
+                        parseInstallment(row.name, row.installment, row.installments);
+                    }
+
+                    row.installments = std::clamp(row.installments, MIN_INSTALLMENT_COUNT, MAX_INSTALLMENT_COUNT);
+                    row.installment  = std::clamp(row.installment, (std::uint32_t) 1, row.installments);
+
+                    // Every statement lists the next installment, rewind to the purchase itself
+                    if (row.installments > 1)
+                    {
+                        row.date  = row.date.addMonths(-((int) row.installment - 1));
+                        row.value = row.value * row.installments;
+                    }
+
+                    if (row.installments <= 1)
+                    {
+                        result.push_back(std::move(row));
+
+                        continue;
+                    }
+
+                    // An export spanning several statements lists the same installment purchase once per statement
+                    QString key = QString("%1|%2|%3|%4")
+                        .arg(row.date.toJulianDay())
+                        .arg(Search::fold(row.name))
+                        .arg(std::lround(row.value * 100.0f))
+                        .arg(row.installments);
+
+                    if (keys.contains(key))
+                    {
+                        continue;
+                    }
+
+                    keys.insert(key);
+
+                    result.push_back(std::move(row));
+                }
+
+                return result;
+            }
+        }
+    }
+}
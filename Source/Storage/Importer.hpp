@@ -0,0 +1,58 @@
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <string>
+#include <vector>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Bank statement exports turned into purchase rows, ready to be committed as one batch
+        namespace Import
+        {
+            enum class Format
+            {
+                Unknown = 0,
+                CSV,
+                OFX
+            };
+
+            struct Row
+            {
+                QDate date;
+                QString name;
+                QString description;
+
+                // Signed as in the export, read() turns charges into positive totals
+                float value = 0.0f;
+
+                // Which of the installments this row charges, exports list one per statement
+                std::uint32_t installment  = 1;
+                std::uint32_t installments = 1;
+
+                Purchase::Type type = Purchase::Type::Other;
+            };
+
+            Format getFormat(const std::string& inFilepath);
+
+            // Rows are handed out as they are parsed, nothing but the current record is buffered
+            void readCSV(std::istream& inStream, const std::function<void(Row&)>& inCallback);
+            void readOFX(std::istream& inStream, const std::function<void(Row&)>& inCallback);
+
+            // Strips an "n/m" installment suffix from the name, returns false when there is none
+            bool parseInstallment(QString& ioName, std::uint32_t& outNumber, std::uint32_t& outCount);
+
+            QDate parseDate(const QString& inDate);
+            float parseValue(const QString& inValue);
+
+            // Charges only, installments rewound to the original purchase, repeated rows collapsed
+            std::vector<Row> read(const std::string& inFilepath);
+        }
+    }
+}
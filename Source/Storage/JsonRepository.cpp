@@ -0,0 +1,217 @@
+#include "Storage/JsonRepository.hpp"
+
+#include <filesystem>
+
+#include <nlohmann/json.hpp>
+
+#include "Base.hpp"
+#include "Storage/PurchaseShards.hpp"
+#include "Storage/Watcher.hpp"
+#include "Storage/Writer.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        JsonRepository::JsonRepository(Watcher* inWatcher)
+            : m_watcher(inWatcher),
+            m_accountsFile()
+        {}
+
+        void JsonRepository::open()
+        {
+            // Shards::migrate() runs from Internal, it needs the legacy purchases normalized first
+            m_accountsFile = FileSystem::readFileAsync(ACCOUNT_FILE_NAME);
+        }
+
+        Backend JsonRepository::getBackend()
+        {
+            return Backend::JSON;
+        }
+
+        QList<User*> JsonRepository::readUsers()
+        {
+            FileSystem::MappedFile file(USER_FILE_NAME);
+
+            if (!file.isOpen())
+            {
+                return {};
+            }
+
+            nlohmann::json users = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+
+            if (!users.is_array())
+            {
+                return {};
+            }
+
+            QList<User*> result {};
+
+            for (auto& it : users.items())
+            {
+                User* user = new User();
+                user->fromJSON(it.value());
+
+                result.push_back(user);
+            }
+
+            return result;
+        }
+
+        void JsonRepository::writeUsers(const QList<User*>& inUsers)
+        {
+            // Written aside and renamed over, so a crash mid-write can't truncate it and the watcher never reads half a file
+            std::string temporaryPath = std::string(USER_FILE_NAME) + ".tmp";
+
+            {
+                Writer writer(temporaryPath);
+                writer.beginArray();
+
+                for (User* user : inUsers)
+                {
+                    user->write(writer);
+                }
+
+                writer.endArray();
+            }
+
+            std::filesystem::rename(
+                temporaryPath,
+                USER_FILE_NAME
+            );
+
+            acknowledge(USER_FILE_NAME);
+        }
+
+        QList<Account*> JsonRepository::readAccounts()
+        {
+            FileSystem::MappedFile file = m_accountsFile.valid() ?
+                m_accountsFile.get() :
+                FileSystem::MappedFile(ACCOUNT_FILE_NAME);
+
+            if (!file.isOpen())
+            {
+                return {};
+            }
+
+            nlohmann::json accounts = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+
+            if (!accounts.is_array())
+            {
+                return {};
+            }
+
+            QList<Account*> result {};
+
+            for (auto& it : accounts.items())
+            {
+                Account* account = new Account();
+                account->fromJSON(it.value());
+
+                result.push_back(account);
+            }
+
+            return result;
+        }
+
+        void JsonRepository::writeAccounts(const QList<Account*>& inAccounts)
+        {
+            if (!FileSystem::doesFileExist(ACCOUNT_FILE_NAME))
+            {
+                return;
+            }
+
+            // Same as writeUsers, renamed over once complete
+            std::string temporaryPath = std::string(ACCOUNT_FILE_NAME) + ".tmp";
+
+            {
+                Writer writer(temporaryPath);
+                writer.beginArray();
+
+                for (Account* account : inAccounts)
+                {
+                    account->write(writer);
+                }
+
+                writer.endArray();
+            }
+
+            std::filesystem::rename(
+                temporaryPath,
+                ACCOUNT_FILE_NAME
+            );
+
+            acknowledge(ACCOUNT_FILE_NAME);
+        }
+
+        QList<Purchase*> JsonRepository::readPurchases(std::uint32_t inAccountId)
+        {
+            return Shards::read(inAccountId);
+        }
+
+        void JsonRepository::writePurchases(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases)
+        {
+            Shards::write(inAccountId, inPurchases);
+
+            acknowledge(Shards::getShardPath(inAccountId));
+        }
+
+        void JsonRepository::savePurchases(
+            std::uint32_t inAccountId,
+            const QList<Purchase*>& inChanged,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            writePurchases(inAccountId, inPurchases);
+        }
+
+        void JsonRepository::deletePurchases(
+            std::uint32_t inAccountId,
+            const QList<std::uint32_t>& inIds,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            writePurchases(inAccountId, inPurchases);
+        }
+
+        void JsonRepository::applyPurchases(
+            std::uint32_t inAccountId,
+            const QList<Purchase*>& inAdded,
+            const QList<std::uint32_t>& inRemovedIds,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            writePurchases(inAccountId, inPurchases);
+        }
+
+        void JsonRepository::removePurchases(std::uint32_t inAccountId)
+        {
+            Shards::remove(inAccountId);
+
+            acknowledge(Shards::getShardPath(inAccountId));
+        }
+
+        void JsonRepository::movePurchases(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId)
+        {
+            Shards::move(inSourceAccountId, inTargetAccountId);
+
+            acknowledge(Shards::getShardPath(inSourceAccountId));
+            acknowledge(Shards::getShardPath(inTargetAccountId));
+        }
+
+        std::uint32_t JsonRepository::allocatePurchaseIds(std::uint32_t inCount)
+        {
+            return Shards::allocateIds(inCount);
+        }
+
+        void JsonRepository::acknowledge(const std::string& inPath)
+        {
+            if (m_watcher == nullptr)
+            {
+                return;
+            }
+
+            m_watcher->acknowledge(inPath);
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <future>
+
+#include "Core/FileSystem.hpp"
+#include "Storage/Repository.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        class Watcher;
+
+        // Data/Users.json, Data/Accounts.json and the purchase shards, every write rewrites a whole file
+        class JsonRepository : public Repository
+        {
+        public:
+            // inWatcher, when set, is told about every file written so only external edits reach it
+            JsonRepository(Watcher* inWatcher = nullptr);
+            ~JsonRepository() = default;
+
+        public:
+            void open() override;
+
+            Backend getBackend() override;
+
+            QList<User*> readUsers() override;
+            void writeUsers(const QList<User*>& inUsers) override;
+
+            QList<Account*> readAccounts() override;
+            void writeAccounts(const QList<Account*>& inAccounts) override;
+
+            QList<Purchase*> readPurchases(std::uint32_t inAccountId) override;
+            void writePurchases(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases) override;
+            void savePurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inChanged,
+                const QList<Purchase*>& inPurchases
+            ) override;
+            void deletePurchases(
+                std::uint32_t inAccountId,
+                const QList<std::uint32_t>& inIds,
+                const QList<Purchase*>& inPurchases
+            ) override;
+            void applyPurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inAdded,
+                const QList<std::uint32_t>& inRemovedIds,
+                const QList<Purchase*>& inPurchases
+            ) override;
+
+            void removePurchases(std::uint32_t inAccountId) override;
+            void movePurchases(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId) override;
+
+            std::uint32_t allocatePurchaseIds(std::uint32_t inCount = 1) override;
+
+        private:
+            void acknowledge(const std::string& inPath);
+
+        private:
+            Watcher* m_watcher;
+
+            // Accounts.json is read while Users.json is parsed, readAccounts() takes it once
+            std::future<FileSystem::MappedFile> m_accountsFile;
+        };
+    }
+}
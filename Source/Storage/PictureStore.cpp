@@ -0,0 +1,140 @@
+#include "Storage/PictureStore.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#include <QCryptographicHash>
+#include <QImage>
+
+#include "Base.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        namespace Pictures
+        {
+            void createThumbnail(const QByteArray& inData, const std::string& inFilepath)
+            {
+                QImage image = QImage::fromData(inData);
+
+                if (image.isNull())
+                {
+                    return;
+                }
+
+                // Square, centre cropped, matching how avatars are displayed
+                image = image.scaled(
+                    THUMBNAIL_SIZE,
+                    THUMBNAIL_SIZE,
+                    Qt::KeepAspectRatioByExpanding,
+                    Qt::SmoothTransformation
+                );
+                image = image.copy(
+                    (image.width()  - (int) THUMBNAIL_SIZE) / 2,
+                    (image.height() - (int) THUMBNAIL_SIZE) / 2,
+                    THUMBNAIL_SIZE,
+                    THUMBNAIL_SIZE
+                );
+
+                image.save(QString::fromStdString(inFilepath), "PNG");
+            }
+
+            QString store(const QByteArray& inData)
+            {
+                if (inData.isEmpty())
+                {
+                    return "";
+                }
+
+                QString hash = QString::fromLatin1(
+                    QCryptographicHash::hash(inData, QCryptographicHash::Sha256).toHex()
+                );
+
+                std::filesystem::create_directories(PICTURE_FOLDER_NAME);
+
+                std::string picturePath = getPicturePath(hash);
+
+                if (!FileSystem::doesFileExist(picturePath))
+                {
+                    std::ofstream stream(picturePath, std::ios::binary);
+                    stream.write(inData.constData(), inData.size());
+                }
+
+                std::string thumbnailPath = getThumbnailPath(hash);
+
+                if (!FileSystem::doesFileExist(thumbnailPath))
+                {
+                    createThumbnail(inData, thumbnailPath);
+                }
+
+                return hash;
+            }
+
+            QString storeFile(const std::string& inFilepath)
+            {
+                FileSystem::MappedFile file(inFilepath);
+
+                return store(QByteArray::fromRawData(file.getData(), file.getSize()));
+            }
+
+            QString storeDataUrl(const QString& inDataUrl)
+            {
+                qsizetype index = inDataUrl.indexOf("base64,");
+
+                if (index < 0)
+                {
+                    return "";
+                }
+
+                return store(
+                    QByteArray::fromBase64(
+                        QStringView(inDataUrl).mid(index + 7).toLatin1()
+                    )
+                );
+            }
+
+            bool isDataUrl(const QString& inPicture)
+            {
+                return inPicture.startsWith("data:");
+            }
+
+            bool has(const QString& inHash)
+            {
+                return !inHash.isEmpty() && FileSystem::doesFileExist(getThumbnailPath(inHash));
+            }
+
+            std::string getPicturePath(const QString& inHash)
+            {
+                std::string path = PICTURE_FOLDER_NAME;
+                path.append("/");
+                path.append(inHash.toStdString());
+
+                return path;
+            }
+
+            std::string getThumbnailPath(const QString& inHash)
+            {
+                std::string path = getPicturePath(inHash);
+                path.append("_");
+                path.append(std::to_string(THUMBNAIL_SIZE));
+                path.append(".png");
+
+                return path;
+            }
+
+            QString getThumbnailUrl(const QString& inHash)
+            {
+                if (!has(inHash))
+                {
+                    return "";
+                }
+
+                return QUrl::fromLocalFile(
+                    QFileInfo(QString::fromStdString(getThumbnailPath(inHash))).absoluteFilePath()
+                ).toString();
+            }
+        }
+    }
+}
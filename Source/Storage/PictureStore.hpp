@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+#include <QtCore>
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Pictures are stored once under Data/Pictures, named after the SHA-256 of their content
+        namespace Pictures
+        {
+            constexpr std::uint32_t THUMBNAIL_SIZE = 256;
+
+            QString store(const QByteArray& inData);
+            QString storeFile(const std::string& inFilepath);
+            QString storeDataUrl(const QString& inDataUrl);
+
+            bool isDataUrl(const QString& inPicture);
+            bool has(const QString& inHash);
+
+            std::string getPicturePath(const QString& inHash);
+            std::string getThumbnailPath(const QString& inHash);
+            QString getThumbnailUrl(const QString& inHash);
+        }
+    }
+}
@@ -0,0 +1,396 @@
+#include "Storage/PurchaseReader.hpp"
+
+#include <stdexcept>
+
+#include "Core/FileSystem.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        PurchaseReader::PurchaseReader(int inAccountId)
+            : m_accountId(inAccountId),
+            m_depth(0),
+            m_isRootArray(false),
+            m_field(Field::None),
+            m_row({}),
+            m_purchases({})
+        {}
+
+        bool PurchaseReader::null()
+        {
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::boolean(bool inValue)
+        {
+            Q_UNUSED(inValue);
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::number_integer(number_integer_t inValue)
+        {
+            if (isRowValue())
+            {
+                setUnsigned(0, false);
+                setNumber((float) inValue);
+            }
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::number_unsigned(number_unsigned_t inValue)
+        {
+            if (isRowValue())
+            {
+                setUnsigned((std::uint32_t) inValue, true);
+                setNumber((float) inValue);
+            }
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::number_float(number_float_t inValue, const string_t& inRaw)
+        {
+            Q_UNUSED(inRaw);
+
+            if (isRowValue())
+            {
+                setUnsigned(0, false);
+                setNumber((float) inValue);
+            }
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::string(string_t& inValue)
+        {
+            if (!isRowValue())
+            {
+                m_field = Field::None;
+
+                return true;
+            }
+
+            switch (m_field)
+            {
+            case Field::Name:
+                m_row.name = std::move(inValue);
+
+                break;
+
+            case Field::Description:
+                m_row.description = std::move(inValue);
+
+                break;
+
+            case Field::Date:
+                m_row.date    = parseDate(inValue);
+                m_row.hasDate = true;
+
+                break;
+
+            case Field::EndDate:
+                m_row.endDate    = parseDate(inValue);
+                m_row.hasEndDate = true;
+
+                break;
+
+            default:
+                break;
+            }
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::binary(binary_t& inValue)
+        {
+            Q_UNUSED(inValue);
+
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::start_object(std::size_t inElements)
+        {
+            Q_UNUSED(inElements);
+
+            m_depth++;
+            m_field = Field::None;
+
+            if (m_depth == 2 && m_isRootArray)
+            {
+                m_row = {};
+            }
+
+            return true;
+        }
+
+        bool PurchaseReader::key(string_t& inValue)
+        {
+            m_field = Field::None;
+
+            if (m_depth != 2 || !m_isRootArray)
+            {
+                return true;
+            }
+
+            if (inValue == "id")
+            {
+                m_field = Field::Id;
+            }
+            else if (inValue == "userId")
+            {
+                m_field = Field::UserId;
+            }
+            else if (inValue == "accountId")
+            {
+                m_field = Field::AccountId;
+            }
+            else if (inValue == "name")
+            {
+                m_field = Field::Name;
+            }
+            else if (inValue == "description")
+            {
+                m_field = Field::Description;
+            }
+            else if (inValue == "date")
+            {
+                m_field = Field::Date;
+            }
+            else if (inValue == "type")
+            {
+                m_field = Field::Type;
+            }
+            else if (inValue == "value")
+            {
+                m_field = Field::Value;
+            }
+            else if (inValue == "installments")
+            {
+                m_field = Field::Installments;
+            }
+            else if (inValue == "endDate")
+            {
+                m_field = Field::EndDate;
+            }
+
+            return true;
+        }
+
+        bool PurchaseReader::end_object()
+        {
+            if (m_depth == 2 && m_isRootArray)
+            {
+                pushRow();
+            }
+
+            m_depth--;
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::start_array(std::size_t inElements)
+        {
+            Q_UNUSED(inElements);
+
+            if (m_depth == 0)
+            {
+                m_isRootArray = true;
+            }
+
+            m_depth++;
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::end_array()
+        {
+            m_depth--;
+            m_field = Field::None;
+
+            return true;
+        }
+
+        bool PurchaseReader::parse_error(
+            std::size_t inPosition,
+            const std::string& inLastToken,
+            const nlohmann::detail::exception& inException
+        )
+        {
+            Q_UNUSED(inPosition);
+            Q_UNUSED(inLastToken);
+            Q_UNUSED(inException);
+
+            return false;
+        }
+
+        QList<Purchase*> PurchaseReader::getPurchases()
+        {
+            return m_purchases;
+        }
+
+        QList<Purchase*> PurchaseReader::takePurchases()
+        {
+            QList<Purchase*> result = m_purchases;
+
+            m_purchases.clear();
+
+            return result;
+        }
+
+        bool PurchaseReader::isRowValue()
+        {
+            return m_depth == 2 && m_isRootArray && !m_row.isSkipped && m_field != Field::None;
+        }
+
+        void PurchaseReader::setUnsigned(std::uint32_t inValue, bool isUnsigned)
+        {
+            switch (m_field)
+            {
+            case Field::Id:
+                m_row.id = isUnsigned ? inValue : 0;
+
+                break;
+
+            case Field::UserId:
+                m_row.userId    = isUnsigned ? inValue : 0;
+                m_row.hasUserId = true;
+
+                break;
+
+            case Field::AccountId:
+                m_row.accountId    = isUnsigned ? inValue : 0;
+                m_row.hasAccountId = true;
+
+                if (m_accountId >= 0 && m_row.accountId != (std::uint32_t) m_accountId)
+                {
+                    m_row = {};
+                    m_row.isSkipped = true;
+                }
+
+                break;
+
+            case Field::Type:
+                m_row.type = isUnsigned ? inValue : (std::uint32_t) Purchase::Type::Other;
+
+                break;
+
+            case Field::Installments:
+                m_row.installments = isUnsigned ? inValue : 1;
+
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        void PurchaseReader::setNumber(float inValue)
+        {
+            if (m_field != Field::Value)
+            {
+                return;
+            }
+
+            m_row.value = inValue;
+        }
+
+        void PurchaseReader::pushRow()
+        {
+            if (m_row.isSkipped || !m_row.hasAccountId || !m_row.hasUserId)
+            {
+                return;
+            }
+
+            Purchase* purchase = new Purchase();
+            purchase->setId(          m_row.id);
+            purchase->setUserId(      m_row.userId);
+            purchase->setAccountId(   m_row.accountId);
+            purchase->setName(        QString::fromStdString(m_row.name));
+            purchase->setDescription( QString::fromStdString(m_row.description));
+            purchase->setDate(        m_row.hasDate ? m_row.date : QDate::currentDate());
+            purchase->setType(        (Purchase::Type) m_row.type);
+            purchase->setValue(       m_row.value);
+            purchase->setInstallments(m_row.installments);
+
+            if (purchase->isRecurring())
+            {
+                purchase->setHasEnded(m_row.hasEndDate);
+                purchase->setEndDate( m_row.hasEndDate ? m_row.endDate : QDate::currentDate());
+            }
+
+            m_purchases.push_back(purchase);
+        }
+
+        QDate parseDate(const std::string& inDate)
+        {
+            // dd/MM/yyyy
+            if (inDate.size() != 10 || inDate[2] != '/' || inDate[5] != '/')
+            {
+                return QDate();
+            }
+
+            int parts[3] = { 0, 0, 0 };
+            int offsets[3][2] = { { 0, 2 }, { 3, 2 }, { 6, 4 } };
+
+            for (std::uint32_t i = 0; i < 3; i++)
+            {
+                for (int j = offsets[i][0]; j < offsets[i][0] + offsets[i][1]; j++)
+                {
+                    char digit = inDate[j];
+
+                    if (digit < '0' || digit > '9')
+                    {
+                        return QDate();
+                    }
+
+                    parts[i] = (parts[i] * 10) + (digit - '0');
+                }
+            }
+
+            return QDate(parts[2], parts[1], parts[0]);
+        }
+
+        QList<Purchase*> readPurchases(const std::string& inFilepath, int inAccountId)
+        {
+            FileSystem::MappedFile file(inFilepath);
+
+            if (!file.isOpen())
+            {
+                throw std::runtime_error("Failed to open file -> " + inFilepath);
+            }
+
+            PurchaseReader reader(inAccountId);
+
+            if (!nlohmann::json::sax_parse(file.getData(), file.getData() + file.getSize(), &reader))
+            {
+                for (Purchase* purchase : reader.takePurchases())
+                {
+                    delete purchase;
+                }
+
+                throw std::runtime_error("Failed to parse file -> " + inFilepath);
+            }
+
+            return reader.takePurchases();
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <string>
+
+#include <QtCore>
+
+#include <nlohmann/json.hpp>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Builds purchases straight out of the parser events, rows from other accounts are dropped before allocation
+        class PurchaseReader : public nlohmann::json_sax<nlohmann::json>
+        {
+        public:
+            PurchaseReader(int inAccountId = -1);
+            ~PurchaseReader() = default;
+
+        public:
+            bool null() override;
+            bool boolean(bool inValue) override;
+            bool number_integer(number_integer_t inValue) override;
+            bool number_unsigned(number_unsigned_t inValue) override;
+            bool number_float(number_float_t inValue, const string_t& inRaw) override;
+            bool string(string_t& inValue) override;
+            bool binary(binary_t& inValue) override;
+
+            bool start_object(std::size_t inElements) override;
+            bool key(string_t& inValue) override;
+            bool end_object() override;
+
+            bool start_array(std::size_t inElements) override;
+            bool end_array() override;
+
+            bool parse_error(
+                std::size_t inPosition,
+                const std::string& inLastToken,
+                const nlohmann::detail::exception& inException
+            ) override;
+
+        public:
+            QList<Purchase*> getPurchases();
+            QList<Purchase*> takePurchases();
+
+        private:
+            enum class Field
+            {
+                None = 0,
+                Id,
+                UserId,
+                AccountId,
+                Name,
+                Description,
+                Date,
+                Type,
+                Value,
+                Installments,
+                EndDate
+            };
+
+            struct Row
+            {
+                bool isSkipped       = false;
+                bool hasUserId       = false;
+                bool hasAccountId    = false;
+                bool hasDate         = false;
+                bool hasEndDate      = false;
+
+                std::uint32_t id           = 0;
+                std::uint32_t userId       = 0;
+                std::uint32_t accountId    = 0;
+                std::uint32_t type         = (std::uint32_t) Purchase::Type::Other;
+                std::uint32_t installments = 1;
+                float value                = 0.0f;
+
+                std::string name        = "";
+                std::string description = "";
+
+                QDate date;
+                QDate endDate;
+            };
+
+        private:
+            bool isRowValue();
+
+            void setUnsigned(std::uint32_t inValue, bool isUnsigned);
+            void setNumber(float inValue);
+
+            void pushRow();
+
+        private:
+            int m_accountId;
+            std::uint32_t m_depth;
+            bool m_isRootArray;
+
+            Field m_field;
+            Row m_row;
+
+            QList<Purchase*> m_purchases;
+        };
+
+        QDate parseDate(const std::string& inDate);
+
+        QList<Purchase*> readPurchases(const std::string& inFilepath, int inAccountId = -1);
+    }
+}
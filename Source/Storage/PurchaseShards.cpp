@@ -0,0 +1,381 @@
+#include "Storage/PurchaseShards.hpp"
+
+#include <filesystem>
+#include <map>
+
+#include <nlohmann/json.hpp>
+
+#include "Base.hpp"
+#include "Core/FileSystem.hpp"
+#include "Search/Fingerprint.hpp"
+#include "Storage/PurchaseReader.hpp"
+#include "Storage/Writer.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        namespace Shards
+        {
+            struct Manifest
+            {
+                bool isLoaded        = false;
+                std::uint32_t nextId = 0;
+
+                // Account id -> purchase count
+                std::map<std::uint32_t, std::uint32_t> shards = {};
+            };
+
+            Manifest manifest;
+
+            void loadManifest()
+            {
+                if (manifest.isLoaded)
+                {
+                    return;
+                }
+
+                manifest.isLoaded = true;
+
+                FileSystem::MappedFile file(PURCHASE_MANIFEST_FILE_NAME);
+
+                if (!file.isOpen())
+                {
+                    return;
+                }
+
+                nlohmann::json data = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+
+                if (!data.is_object())
+                {
+                    return;
+                }
+
+                manifest.nextId = data.find("nextId") != data.end() && data.at("nextId").is_number_unsigned() ?
+                    (std::uint32_t) data.at("nextId") :
+                    0;
+
+                if (data.find("shards") == data.end() || !data.at("shards").is_array())
+                {
+                    return;
+                }
+
+                for (auto& [key, shard] : data.at("shards").items())
+                {
+                    if (shard.find("accountId") == shard.end() || !shard.at("accountId").is_number_unsigned())
+                    {
+                        continue;
+                    }
+
+                    manifest.shards[(std::uint32_t) shard.at("accountId")] = shard.find("count") != shard.end() && shard.at("count").is_number_unsigned() ?
+                        (std::uint32_t) shard.at("count") :
+                        0;
+                }
+            }
+
+            void writeManifest()
+            {
+                nlohmann::ordered_json shards = nlohmann::ordered_json::array();
+
+                for (auto& [accountId, count] : manifest.shards)
+                {
+                    shards.push_back(
+                        {
+                            { "accountId", accountId },
+                            { "file",      std::to_string(accountId) + ".json" },
+                            { "count",     count }
+                        }
+                    );
+                }
+
+                nlohmann::ordered_json data = {
+                    { "version", 1 },
+                    { "nextId",  manifest.nextId },
+                    { "shards",  shards }
+                };
+
+                std::filesystem::create_directories(PURCHASE_FOLDER_NAME);
+
+                // Rewritten on every new id, a torn manifest would hand out ids again
+                FileSystem::writeFile(PURCHASE_MANIFEST_FILE_NAME, data.dump(4) + "\n");
+            }
+
+            void normalize(const std::unordered_map<std::uint32_t, std::uint32_t>& inOwners)
+            {
+                nlohmann::json purchases    = nullptr;
+                nlohmann::json newPurchases = nlohmann::json::array();
+
+                // The mapping goes before the file is replaced
+                {
+                    FileSystem::MappedFile file(PURCHASE_FILE_NAME);
+
+                    if (!file.isOpen())
+                    {
+                        return;
+                    }
+
+                    purchases = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+                }
+
+                if (!purchases.is_array())
+                {
+                    return;
+                }
+
+                bool didNormalize = false;
+
+                for (auto& it : purchases.items())
+                {
+                    auto purchase = it.value();
+
+                    if (purchase.find("userId") != purchase.end())
+                    {
+                        newPurchases.push_back(purchase);
+
+                        continue;
+                    }
+
+                    auto owner = inOwners.find((std::uint32_t) purchase.at("accountId"));
+
+                    if (owner == inOwners.end())
+                    {
+                        newPurchases.push_back(purchase);
+
+                        continue;
+                    }
+
+                    newPurchases.push_back(
+                        {
+                            { "id",           purchase.at("id") },
+                            { "userId",       owner->second },
+                            { "accountId",    purchase.at("accountId") },
+                            { "name",         purchase.at("name") },
+                            { "description",  purchase.at("description") },
+                            { "date",         purchase.at("date") },
+                            { "type",         purchase.at("type") },
+                            { "value",        purchase.at("value") },
+                            { "installments", purchase.at("installments") }
+                        }
+                    );
+
+                    didNormalize = true;
+                }
+
+                if (!didNormalize)
+                {
+                    return;
+                }
+
+                // Write
+                FileSystem::writeFile(PURCHASE_FILE_NAME, newPurchases.dump(4) + "\n");
+            }
+
+            void migrate()
+            {
+                if (FileSystem::doesFileExist(PURCHASE_MANIFEST_FILE_NAME))
+                {
+                    loadManifest();
+
+                    return;
+                }
+
+                manifest          = {};
+                manifest.isLoaded = true;
+
+                std::filesystem::create_directories(PURCHASE_FOLDER_NAME);
+
+                if (!FileSystem::doesFileExist(PURCHASE_FILE_NAME))
+                {
+                    writeManifest();
+
+                    return;
+                }
+
+                QList<Purchase*> purchases = readPurchases(PURCHASE_FILE_NAME);
+
+                std::map<std::uint32_t, QList<Purchase*>> accountPurchases {};
+
+                for (Purchase* purchase : purchases)
+                {
+                    accountPurchases[purchase->getAccountId()].push_back(purchase);
+
+                    manifest.nextId = std::max(
+                        manifest.nextId,
+                        purchase->getId() + 1
+                    );
+                }
+
+                for (auto& [accountId, shardPurchases] : accountPurchases)
+                {
+                    write(accountId, shardPurchases);
+                }
+
+                writeManifest();
+
+                for (Purchase* purchase : purchases)
+                {
+                    delete purchase;
+                }
+
+                // Keep the legacy file around, nothing recreates Purchases.json anymore
+                std::filesystem::remove(PURCHASE_BACKUP_FILE_NAME);
+                std::filesystem::rename(
+                    PURCHASE_FILE_NAME,
+                    PURCHASE_BACKUP_FILE_NAME
+                );
+            }
+
+            std::string getShardPath(std::uint32_t inAccountId)
+            {
+                std::string path = PURCHASE_FOLDER_NAME;
+                path.append("/");
+                path.append(std::to_string(inAccountId));
+                path.append(".json");
+
+                return path;
+            }
+
+            bool hasShard(std::uint32_t inAccountId)
+            {
+                return FileSystem::doesFileExist(getShardPath(inAccountId));
+            }
+
+            QList<Purchase*> read(std::uint32_t inAccountId)
+            {
+                loadManifest();
+
+                if (!hasShard(inAccountId))
+                {
+                    return {};
+                }
+
+                // The shard is authoritative, rows moved by a merge still carry their old accountId
+                QList<Purchase*> result = readPurchases(getShardPath(inAccountId));
+
+                for (Purchase* purchase : result)
+                {
+                    purchase->setAccountId(inAccountId);
+                }
+
+                return result;
+            }
+
+            void write(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases)
+            {
+                loadManifest();
+
+                std::filesystem::create_directories(PURCHASE_FOLDER_NAME);
+
+                std::string path          = getShardPath(inAccountId);
+                std::string temporaryPath = path + ".tmp";
+
+                {
+                    Writer writer(temporaryPath);
+                    writer.beginArray();
+
+                    for (Purchase* purchase : inPurchases)
+                    {
+                        purchase->write(writer);
+
+                        manifest.nextId = std::max(
+                            manifest.nextId,
+                            purchase->getId() + 1
+                        );
+                    }
+
+                    writer.endArray();
+                }
+
+                std::filesystem::rename(
+                    temporaryPath,
+                    path
+                );
+
+                manifest.shards[inAccountId] = inPurchases.size();
+
+                writeManifest();
+            }
+
+            void remove(std::uint32_t inAccountId)
+            {
+                loadManifest();
+
+                std::filesystem::remove(getShardPath(inAccountId));
+
+                if (manifest.shards.erase(inAccountId) == 0)
+                {
+                    return;
+                }
+
+                writeManifest();
+            }
+
+            void move(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId)
+            {
+                if (inSourceAccountId == inTargetAccountId || !hasShard(inSourceAccountId))
+                {
+                    return;
+                }
+
+                loadManifest();
+
+                if (!hasShard(inTargetAccountId))
+                {
+                    std::filesystem::rename(
+                        getShardPath(inSourceAccountId),
+                        getShardPath(inTargetAccountId)
+                    );
+
+                    manifest.shards[inTargetAccountId] = manifest.shards[inSourceAccountId];
+                    manifest.shards.erase(inSourceAccountId);
+
+                    writeManifest();
+
+                    return;
+                }
+
+                QList<Purchase*> purchases       = read(inTargetAccountId);
+                QList<Purchase*> sourcePurchases = read(inSourceAccountId);
+
+                // Charges both accounts already hold stay in the target once
+                QList<Purchase*> duplicates = Search::takeDuplicates(
+                    Search::countFingerprints(purchases),
+                    sourcePurchases
+                );
+
+                purchases.append(sourcePurchases);
+
+                for (Purchase* purchase : purchases)
+                {
+                    purchase->setAccountId(inTargetAccountId);
+                }
+
+                write(inTargetAccountId, purchases);
+                remove(inSourceAccountId);
+
+                for (Purchase* purchase : purchases)
+                {
+                    delete purchase;
+                }
+
+                for (Purchase* purchase : duplicates)
+                {
+                    delete purchase;
+                }
+            }
+
+            std::uint32_t allocateIds(std::uint32_t inCount)
+            {
+                loadManifest();
+
+                std::uint32_t result = manifest.nextId;
+
+                manifest.nextId += inCount;
+
+                writeManifest();
+
+                return result;
+            }
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <QtCore>
+
+#include "UI/Purchase.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // One purchase file per account under Data/Purchases, indexed by Manifest.json
+        namespace Shards
+        {
+            // Legacy Purchases.json rows without a userId get their account's owner, inOwners maps
+            // account id -> user id. Runs before migrate(), the reader drops rows without one
+            void normalize(const std::unordered_map<std::uint32_t, std::uint32_t>& inOwners);
+            void migrate();
+
+            std::string getShardPath(std::uint32_t inAccountId);
+            bool hasShard(std::uint32_t inAccountId);
+
+            QList<Purchase*> read(std::uint32_t inAccountId);
+            void write(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases);
+            void remove(std::uint32_t inAccountId);
+            void move(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId);
+
+            // Returns the first id of a contiguous range of inCount ids
+            std::uint32_t allocateIds(std::uint32_t inCount = 1);
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#include "Storage/Repository.hpp"
+
+#include "Storage/JsonRepository.hpp"
+#include "Storage/SQLiteRepository.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        std::unique_ptr<Repository> createRepository(Backend inBackend, Watcher* inWatcher)
+        {
+            switch (inBackend)
+            {
+            case Backend::SQLite:
+                return std::make_unique<SQLiteRepository>();
+            case Backend::JSON:
+            default:
+                return std::make_unique<JsonRepository>(inWatcher);
+            }
+        }
+    }
+}
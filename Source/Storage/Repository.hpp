@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+
+#include <QtCore>
+
+#include "UI/Account.hpp"
+#include "UI/Purchase.hpp"
+#include "UI/User.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        enum class Backend
+        {
+            JSON = 0,
+            SQLite
+        };
+
+        // Where users, accounts and purchases are persisted, Internal and Account only talk to this
+        class Repository
+        {
+        public:
+            virtual ~Repository() = default;
+
+        public:
+            // Called once on start, before anything is read
+            virtual void open() = 0;
+
+            virtual Backend getBackend() = 0;
+
+            // Callers own what is returned
+            virtual QList<User*> readUsers() = 0;
+            virtual void writeUsers(const QList<User*>& inUsers) = 0;
+
+            virtual QList<Account*> readAccounts() = 0;
+            virtual void writeAccounts(const QList<Account*>& inAccounts) = 0;
+
+            virtual QList<Purchase*> readPurchases(std::uint32_t inAccountId) = 0;
+
+            // inPurchases is always the account's full list, stores with row level writes only use
+            // the changed rows, the others rewrite the account
+            virtual void writePurchases(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases) = 0;
+            virtual void savePurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inChanged,
+                const QList<Purchase*>& inPurchases
+            ) = 0;
+            virtual void deletePurchases(
+                std::uint32_t inAccountId,
+                const QList<std::uint32_t>& inIds,
+                const QList<Purchase*>& inPurchases
+            ) = 0;
+            // Saves inAdded and deletes inRemovedIds as one write
+            virtual void applyPurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inAdded,
+                const QList<std::uint32_t>& inRemovedIds,
+                const QList<Purchase*>& inPurchases
+            ) = 0;
+
+            virtual void removePurchases(std::uint32_t inAccountId) = 0;
+            virtual void movePurchases(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId) = 0;
+
+            // Returns the first id of a contiguous range of inCount ids
+            virtual std::uint32_t allocatePurchaseIds(std::uint32_t inCount = 1) = 0;
+        };
+
+        class Watcher;
+
+        // inWatcher is told about the files the JSON store writes, the others don't write watched files
+        std::unique_ptr<Repository> createRepository(Backend inBackend, Watcher* inWatcher = nullptr);
+    }
+}
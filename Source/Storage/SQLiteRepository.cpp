@@ -0,0 +1,623 @@
+#include "Storage/SQLiteRepository.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <unordered_map>
+
+#include <QSqlError>
+
+#include "Base.hpp"
+#include "Core/FileSystem.hpp"
+#include "Search/Fingerprint.hpp"
+#include "Storage/JsonRepository.hpp"
+#include "Storage/PurchaseShards.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        SQLiteRepository::SQLiteRepository()
+            : m_database(QSqlDatabase::addDatabase("QSQLITE", CONNECTION_NAME)),
+            m_isOpen(false),
+            m_nextPurchaseId(0)
+        {
+        }
+
+        SQLiteRepository::~SQLiteRepository()
+        {
+            // Every query holds the connection, they go before it is removed
+            m_selectPurchases        = QSqlQuery();
+            m_createPurchase         = QSqlQuery();
+            m_editPurchase           = QSqlQuery();
+            m_deletePurchase         = QSqlQuery();
+            m_deleteAccountPurchases = QSqlQuery();
+
+            m_database.close();
+            m_database = QSqlDatabase();
+
+            QSqlDatabase::removeDatabase(CONNECTION_NAME);
+        }
+
+        void SQLiteRepository::open()
+        {
+            std::filesystem::create_directories(DATA_FOLDER_NAME);
+
+            bool isNew = !FileSystem::doesFileExist(DATABASE_FILE_NAME);
+
+            m_database.setDatabaseName(DATABASE_FILE_NAME);
+
+            if (!m_database.open())
+            {
+                qWarning() << "Failed to open" << DATABASE_FILE_NAME << m_database.lastError().text();
+
+                return;
+            }
+
+            m_isOpen = true;
+
+            // Readers aren't blocked by a commit, and a commit only syncs at checkpoints
+            execute("PRAGMA journal_mode = WAL");
+            execute("PRAGMA synchronous = NORMAL");
+
+            createSchema();
+
+            prepare(
+                m_selectPurchases,
+                "SELECT id, userId, name, description, type, value, installments, date, endDate "
+                "FROM purchases WHERE accountId = :accountId ORDER BY date, id"
+            );
+            prepare(
+                m_createPurchase,
+                "INSERT INTO purchases (id, userId, accountId, name, description, type, value, installments, date, endDate) "
+                "VALUES (:id, :userId, :accountId, :name, :description, :type, :value, :installments, :date, :endDate)"
+            );
+            prepare(
+                m_editPurchase,
+                "UPDATE purchases SET userId = :userId, accountId = :accountId, name = :name, description = :description, "
+                "type = :type, value = :value, installments = :installments, date = :date, endDate = :endDate "
+                "WHERE id = :id"
+            );
+            prepare(
+                m_deletePurchase,
+                "DELETE FROM purchases WHERE id = :id"
+            );
+            prepare(
+                m_deleteAccountPurchases,
+                "DELETE FROM purchases WHERE accountId = :accountId"
+            );
+
+            if (isNew)
+            {
+                import();
+            }
+
+            QSqlQuery query("SELECT COALESCE(MAX(id) + 1, 0) FROM purchases", m_database);
+
+            if (query.next())
+            {
+                m_nextPurchaseId = query.value(0).toUInt();
+            }
+        }
+
+        Backend SQLiteRepository::getBackend()
+        {
+            return Backend::SQLite;
+        }
+
+        QList<User*> SQLiteRepository::readUsers()
+        {
+            if (!m_isOpen)
+            {
+                return {};
+            }
+
+            QSqlQuery query(
+                "SELECT id, firstName, lastName, income, picture, primaryColor, secondaryColor FROM users ORDER BY id",
+                m_database
+            );
+
+            QList<User*> result {};
+
+            while (query.next())
+            {
+                UserData data;
+                data.id             = query.value(0).toUInt();
+                data.firstName      = query.value(1).toString();
+                data.lastName       = query.value(2).toString();
+                data.income         = query.value(3).toFloat();
+                data.picture        = query.value(4).toString();
+                data.primaryColor   = QColor(query.value(5).toString());
+                data.secondaryColor = QColor(query.value(6).toString());
+
+                User* user = new User();
+                user->fromData(data);
+
+                result.push_back(user);
+            }
+
+            return result;
+        }
+
+        void SQLiteRepository::writeUsers(const QList<User*>& inUsers)
+        {
+            if (!m_isOpen)
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            execute("DELETE FROM users");
+
+            QSqlQuery query(m_database);
+            prepare(
+                query,
+                "INSERT INTO users (id, firstName, lastName, income, picture, primaryColor, secondaryColor) "
+                "VALUES (:id, :firstName, :lastName, :income, :picture, :primaryColor, :secondaryColor)"
+            );
+
+            for (User* user : inUsers)
+            {
+                UserData data = user->toData();
+
+                query.bindValue(":id",             data.id);
+                query.bindValue(":firstName",      data.firstName);
+                query.bindValue(":lastName",       data.lastName);
+                query.bindValue(":income",         data.income);
+                query.bindValue(":picture",        data.picture);
+                query.bindValue(":primaryColor",   data.primaryColor.name());
+                query.bindValue(":secondaryColor", data.secondaryColor.name());
+                query.exec();
+            }
+
+            m_database.commit();
+        }
+
+        QList<Account*> SQLiteRepository::readAccounts()
+        {
+            if (!m_isOpen)
+            {
+                return {};
+            }
+
+            std::unordered_map<std::uint32_t, QList<int>> sharedUserIds {};
+
+            QSqlQuery sharing("SELECT accountId, userId FROM sharing ORDER BY accountId, userId", m_database);
+
+            while (sharing.next())
+            {
+                sharedUserIds[sharing.value(0).toUInt()].push_back(sharing.value(1).toInt());
+            }
+
+            QSqlQuery query(
+                "SELECT id, userId, name, closingDay, type, \"limit\", primaryColor, secondaryColor FROM accounts ORDER BY id",
+                m_database
+            );
+
+            QList<Account*> result {};
+
+            while (query.next())
+            {
+                AccountData data;
+                data.id             = query.value(0).toUInt();
+                data.userId         = query.value(1).toUInt();
+                data.sharedUserIds  = sharedUserIds[data.id];
+                data.name           = query.value(2).toString();
+                data.closingDay     = query.value(3).toUInt();
+                data.type           = (Account::Type) query.value(4).toInt();
+                data.limit          = query.value(5).toFloat();
+                data.primaryColor   = QColor(query.value(6).toString());
+                data.secondaryColor = QColor(query.value(7).toString());
+
+                Account* account = new Account();
+                account->fromData(data);
+
+                result.push_back(account);
+            }
+
+            return result;
+        }
+
+        void SQLiteRepository::writeAccounts(const QList<Account*>& inAccounts)
+        {
+            if (!m_isOpen)
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            execute("DELETE FROM sharing");
+            execute("DELETE FROM accounts");
+
+            QSqlQuery query(m_database);
+            prepare(
+                query,
+                "INSERT INTO accounts (id, userId, name, closingDay, type, \"limit\", primaryColor, secondaryColor) "
+                "VALUES (:id, :userId, :name, :closingDay, :type, :limit, :primaryColor, :secondaryColor)"
+            );
+
+            QSqlQuery sharing(m_database);
+            prepare(
+                sharing,
+                "INSERT OR IGNORE INTO sharing (accountId, userId) VALUES (:accountId, :userId)"
+            );
+
+            for (Account* account : inAccounts)
+            {
+                AccountData data = account->toData();
+
+                query.bindValue(":id",             data.id);
+                query.bindValue(":userId",         data.userId);
+                query.bindValue(":name",           data.name);
+                query.bindValue(":closingDay",     data.closingDay);
+                query.bindValue(":type",           (int) data.type);
+                query.bindValue(":limit",          data.limit);
+                query.bindValue(":primaryColor",   data.primaryColor.name());
+                query.bindValue(":secondaryColor", data.secondaryColor.name());
+                query.exec();
+
+                for (int userId : data.sharedUserIds)
+                {
+                    sharing.bindValue(":accountId", data.id);
+                    sharing.bindValue(":userId",    userId);
+                    sharing.exec();
+                }
+            }
+
+            m_database.commit();
+        }
+
+        QList<Purchase*> SQLiteRepository::readPurchases(std::uint32_t inAccountId)
+        {
+            if (!m_isOpen)
+            {
+                return {};
+            }
+
+            m_selectPurchases.bindValue(":accountId", inAccountId);
+
+            if (!m_selectPurchases.exec())
+            {
+                return {};
+            }
+
+            QList<Purchase*> result {};
+
+            while (m_selectPurchases.next())
+            {
+                PurchaseData data;
+                data.id           = m_selectPurchases.value(0).toUInt();
+                data.userId       = m_selectPurchases.value(1).toUInt();
+                data.accountId    = inAccountId;
+                data.name         = m_selectPurchases.value(2).toString();
+                data.description  = m_selectPurchases.value(3).toString();
+                data.type         = (Purchase::Type) m_selectPurchases.value(4).toInt();
+                data.value        = m_selectPurchases.value(5).toFloat();
+                data.installments = m_selectPurchases.value(6).toUInt();
+                data.date         = QDate::fromJulianDay(m_selectPurchases.value(7).toLongLong());
+                data.hasEnded     = !m_selectPurchases.value(8).isNull();
+
+                if (data.hasEnded)
+                {
+                    data.endDate = QDate::fromJulianDay(m_selectPurchases.value(8).toLongLong());
+                }
+
+                Purchase* purchase = new Purchase();
+                purchase->fromData(data);
+
+                result.push_back(purchase);
+            }
+
+            m_selectPurchases.finish();
+
+            return result;
+        }
+
+        void SQLiteRepository::writePurchases(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases)
+        {
+            if (!m_isOpen)
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            m_deleteAccountPurchases.bindValue(":accountId", inAccountId);
+            m_deleteAccountPurchases.exec();
+
+            for (Purchase* purchase : inPurchases)
+            {
+                bindPurchase(m_createPurchase, purchase->toData());
+                m_createPurchase.exec();
+
+                m_nextPurchaseId = std::max(m_nextPurchaseId, purchase->getId() + 1);
+            }
+
+            m_database.commit();
+        }
+
+        void SQLiteRepository::savePurchases(
+            std::uint32_t inAccountId,
+            const QList<Purchase*>& inChanged,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            if (!m_isOpen || inChanged.isEmpty())
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            for (Purchase* purchase : inChanged)
+            {
+                savePurchase(purchase);
+            }
+
+            m_database.commit();
+        }
+
+        void SQLiteRepository::deletePurchases(
+            std::uint32_t inAccountId,
+            const QList<std::uint32_t>& inIds,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            if (!m_isOpen || inIds.isEmpty())
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            for (std::uint32_t id : inIds)
+            {
+                m_deletePurchase.bindValue(":id", id);
+                m_deletePurchase.exec();
+            }
+
+            m_database.commit();
+        }
+
+        void SQLiteRepository::applyPurchases(
+            std::uint32_t inAccountId,
+            const QList<Purchase*>& inAdded,
+            const QList<std::uint32_t>& inRemovedIds,
+            const QList<Purchase*>& inPurchases
+        )
+        {
+            if (!m_isOpen || (inAdded.isEmpty() && inRemovedIds.isEmpty()))
+            {
+                return;
+            }
+
+            m_database.transaction();
+
+            for (std::uint32_t id : inRemovedIds)
+            {
+                m_deletePurchase.bindValue(":id", id);
+                m_deletePurchase.exec();
+            }
+
+            for (Purchase* purchase : inAdded)
+            {
+                savePurchase(purchase);
+            }
+
+            m_database.commit();
+        }
+
+        void SQLiteRepository::removePurchases(std::uint32_t inAccountId)
+        {
+            if (!m_isOpen)
+            {
+                return;
+            }
+
+            m_deleteAccountPurchases.bindValue(":accountId", inAccountId);
+            m_deleteAccountPurchases.exec();
+        }
+
+        void SQLiteRepository::movePurchases(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId)
+        {
+            if (!m_isOpen || inSourceAccountId == inTargetAccountId)
+            {
+                return;
+            }
+
+            QList<Purchase*> purchases       = readPurchases(inTargetAccountId);
+            QList<Purchase*> sourcePurchases = readPurchases(inSourceAccountId);
+
+            // Same rule as the shards, charges both accounts already hold stay in the target once
+            QList<Purchase*> duplicates = Search::takeDuplicates(
+                Search::countFingerprints(purchases),
+                sourcePurchases
+            );
+
+            m_database.transaction();
+
+            for (Purchase* purchase : duplicates)
+            {
+                m_deletePurchase.bindValue(":id", purchase->getId());
+                m_deletePurchase.exec();
+            }
+
+            QSqlQuery query(m_database);
+            prepare(
+                query,
+                "UPDATE purchases SET accountId = :targetId WHERE accountId = :sourceId"
+            );
+            query.bindValue(":targetId", inTargetAccountId);
+            query.bindValue(":sourceId", inSourceAccountId);
+            query.exec();
+
+            m_database.commit();
+
+            for (Purchase* purchase : purchases + sourcePurchases + duplicates)
+            {
+                delete purchase;
+            }
+        }
+
+        std::uint32_t SQLiteRepository::allocatePurchaseIds(std::uint32_t inCount)
+        {
+            // Handed out ids may not be saved yet, so MAX(id) alone isn't enough
+            std::uint32_t result = m_nextPurchaseId;
+
+            m_nextPurchaseId += inCount;
+
+            return result;
+        }
+
+        bool SQLiteRepository::execute(const QString& inStatement)
+        {
+            QSqlQuery query(m_database);
+
+            if (query.exec(inStatement))
+            {
+                return true;
+            }
+
+            qWarning() << "SQLite:" << query.lastError().text();
+
+            return false;
+        }
+
+        void SQLiteRepository::prepare(QSqlQuery& outQuery, const QString& inStatement)
+        {
+            outQuery = QSqlQuery(m_database);
+
+            if (outQuery.prepare(inStatement))
+            {
+                return;
+            }
+
+            qWarning() << "SQLite:" << outQuery.lastError().text();
+        }
+
+        void SQLiteRepository::createSchema()
+        {
+            // Dates are Julian days, endDate is NULL until a purchase is cancelled
+            execute(
+                "CREATE TABLE IF NOT EXISTS users ("
+                "id INTEGER PRIMARY KEY, firstName TEXT NOT NULL, lastName TEXT NOT NULL, income REAL NOT NULL, "
+                "picture TEXT NOT NULL, primaryColor TEXT NOT NULL, secondaryColor TEXT NOT NULL)"
+            );
+            execute(
+                "CREATE TABLE IF NOT EXISTS accounts ("
+                "id INTEGER PRIMARY KEY, userId INTEGER NOT NULL, name TEXT NOT NULL, closingDay INTEGER NOT NULL, "
+                "type INTEGER NOT NULL, \"limit\" REAL NOT NULL, primaryColor TEXT NOT NULL, secondaryColor TEXT NOT NULL)"
+            );
+            execute(
+                "CREATE TABLE IF NOT EXISTS sharing ("
+                "accountId INTEGER NOT NULL, userId INTEGER NOT NULL, PRIMARY KEY (accountId, userId))"
+            );
+            execute(
+                "CREATE TABLE IF NOT EXISTS purchases ("
+                "id INTEGER PRIMARY KEY, userId INTEGER NOT NULL, accountId INTEGER NOT NULL, name TEXT NOT NULL, "
+                "description TEXT NOT NULL, type INTEGER NOT NULL, value REAL NOT NULL, installments INTEGER NOT NULL, "
+                "date INTEGER NOT NULL, endDate INTEGER)"
+            );
+
+            execute("CREATE INDEX IF NOT EXISTS purchasesAccountDate ON purchases (accountId, date)");
+            execute("CREATE INDEX IF NOT EXISTS purchasesUser ON purchases (userId)");
+            execute("CREATE INDEX IF NOT EXISTS purchasesType ON purchases (type)");
+
+            execute(QString("PRAGMA user_version = %1").arg(SCHEMA_VERSION));
+        }
+
+        void SQLiteRepository::import()
+        {
+            JsonRepository json;
+
+            QList<User*> users       = json.readUsers();
+            QList<Account*> accounts = json.readAccounts();
+
+            // A legacy Purchases.json gets the userIds the JSON store would have filled on start, then
+            // is split into shards, the import only reads shards
+            std::unordered_map<std::uint32_t, std::uint32_t> owners {};
+
+            for (Account* account : accounts)
+            {
+                bool hasOwner = std::any_of(
+                    users.begin(),
+                    users.end(),
+                    [account](User* _) { return _->getId() == account->getUserId(); }
+                );
+
+                if (!hasOwner)
+                {
+                    continue;
+                }
+
+                owners[account->getId()] = account->getUserId();
+            }
+
+            Shards::normalize(owners);
+            Shards::migrate();
+
+            writeUsers(users);
+            writeAccounts(accounts);
+
+            for (Account* account : accounts)
+            {
+                QList<Purchase*> purchases = json.readPurchases(account->getId());
+
+                writePurchases(account->getId(), purchases);
+
+                for (Purchase* purchase : purchases)
+                {
+                    delete purchase;
+                }
+            }
+
+            for (User* user : users)
+            {
+                delete user;
+            }
+
+            for (Account* account : accounts)
+            {
+                delete account;
+            }
+        }
+
+        void SQLiteRepository::savePurchase(Purchase* inPurchase)
+        {
+            PurchaseData data = inPurchase->toData();
+
+            bindPurchase(m_editPurchase, data);
+            m_editPurchase.exec();
+
+            if (m_editPurchase.numRowsAffected() > 0)
+            {
+                return;
+            }
+
+            bindPurchase(m_createPurchase, data);
+            m_createPurchase.exec();
+
+            m_nextPurchaseId = std::max(m_nextPurchaseId, data.id + 1);
+        }
+
+        void SQLiteRepository::bindPurchase(QSqlQuery& ioQuery, const PurchaseData& inData)
+        {
+            ioQuery.bindValue(":id",           inData.id);
+            ioQuery.bindValue(":userId",       inData.userId);
+            ioQuery.bindValue(":accountId",    inData.accountId);
+            ioQuery.bindValue(":name",         inData.name);
+            ioQuery.bindValue(":description",  inData.description);
+            ioQuery.bindValue(":type",         (int) inData.type);
+            ioQuery.bindValue(":value",        inData.value);
+            ioQuery.bindValue(":installments", inData.installments);
+            ioQuery.bindValue(":date",         inData.date.toJulianDay());
+            ioQuery.bindValue(
+                ":endDate",
+                inData.hasEnded ?
+                    QVariant(inData.endDate.toJulianDay()) :
+                    QVariant()
+            );
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QtCore>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+
+#include "Storage/Repository.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Data/Financy.db through Qt's bundled QSQLITE driver, purchases are written row by row
+        class SQLiteRepository : public Repository
+        {
+        public:
+            static constexpr auto CONNECTION_NAME = "Financy";
+            static constexpr int SCHEMA_VERSION   = 1;
+
+        public:
+            SQLiteRepository();
+            ~SQLiteRepository();
+
+        public:
+            // Creates the schema and, for a new database, imports what Data/*.json holds
+            void open() override;
+
+            Backend getBackend() override;
+
+            QList<User*> readUsers() override;
+            void writeUsers(const QList<User*>& inUsers) override;
+
+            QList<Account*> readAccounts() override;
+            void writeAccounts(const QList<Account*>& inAccounts) override;
+
+            QList<Purchase*> readPurchases(std::uint32_t inAccountId) override;
+            void writePurchases(std::uint32_t inAccountId, const QList<Purchase*>& inPurchases) override;
+            void savePurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inChanged,
+                const QList<Purchase*>& inPurchases
+            ) override;
+            void deletePurchases(
+                std::uint32_t inAccountId,
+                const QList<std::uint32_t>& inIds,
+                const QList<Purchase*>& inPurchases
+            ) override;
+            void applyPurchases(
+                std::uint32_t inAccountId,
+                const QList<Purchase*>& inAdded,
+                const QList<std::uint32_t>& inRemovedIds,
+                const QList<Purchase*>& inPurchases
+            ) override;
+
+            void removePurchases(std::uint32_t inAccountId) override;
+            void movePurchases(std::uint32_t inSourceAccountId, std::uint32_t inTargetAccountId) override;
+
+            std::uint32_t allocatePurchaseIds(std::uint32_t inCount = 1) override;
+
+        private:
+            bool execute(const QString& inStatement);
+            void prepare(QSqlQuery& outQuery, const QString& inStatement);
+
+            void createSchema();
+            void import();
+
+            // Tries the edit statement first, rows it didn't touch are new
+            void savePurchase(Purchase* inPurchase);
+            void bindPurchase(QSqlQuery& ioQuery, const PurchaseData& inData);
+
+        private:
+            QSqlDatabase m_database;
+            bool m_isOpen;
+
+            std::uint32_t m_nextPurchaseId;
+
+            QSqlQuery m_selectPurchases;
+            QSqlQuery m_createPurchase;
+            QSqlQuery m_editPurchase;
+            QSqlQuery m_deletePurchase;
+            QSqlQuery m_deleteAccountPurchases;
+        };
+    }
+}
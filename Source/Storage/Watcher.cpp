@@ -0,0 +1,195 @@
+#include "Storage/Watcher.hpp"
+
+#include <string_view>
+
+#include "Base.hpp"
+#include "Core/FileSystem.hpp"
+
+namespace Financy
+{
+    namespace Storage
+    {
+        std::size_t getContentHash(const nlohmann::json& inData)
+        {
+            return std::hash<nlohmann::json>{}(inData);
+        }
+
+        Watcher::Watcher(QObject* parent)
+            : QObject(parent),
+            m_watcher(),
+            m_timer(),
+            m_stamps({}),
+            m_pending({})
+        {
+            m_timer.setSingleShot(true);
+            m_timer.setInterval(DEBOUNCE_INTERVAL);
+
+            connect(&m_timer,   &QTimer::timeout,                      this, &Watcher::flush);
+            connect(&m_watcher, &QFileSystemWatcher::fileChanged,      this, &Watcher::schedule);
+            connect(&m_watcher, &QFileSystemWatcher::directoryChanged, this, &Watcher::schedule);
+        }
+
+        void Watcher::start()
+        {
+            m_stamps.clear();
+
+            didChange(USER_FILE_NAME);
+            didChange(ACCOUNT_FILE_NAME);
+
+            for (const QString& path : getShardPaths())
+            {
+                didChange(path.toStdString());
+            }
+
+            watch();
+        }
+
+        void Watcher::acknowledge(const std::string& inPath)
+        {
+            didChange(inPath);
+        }
+
+        void Watcher::schedule(const QString& inPath)
+        {
+            m_pending.insert(inPath);
+
+            m_timer.start();
+        }
+
+        void Watcher::flush()
+        {
+            QSet<QString> pending = m_pending;
+            m_pending.clear();
+
+            // Atomic saves replace the file, which drops it from the watcher
+            watch();
+
+            if (pending.contains(USER_FILE_NAME) && didChange(USER_FILE_NAME))
+            {
+                emit onUsersChange();
+            }
+
+            if (pending.contains(ACCOUNT_FILE_NAME) && didChange(ACCOUNT_FILE_NAME))
+            {
+                emit onAccountsChange();
+            }
+
+            QSet<QString> shards {};
+
+            for (const QString& path : getShardPaths())
+            {
+                shards.insert(path);
+            }
+
+            // Shards that went away are reported too, the account then reloads as empty
+            for (auto& [path, stamp] : m_stamps)
+            {
+                if (path.rfind(PURCHASE_FOLDER_NAME, 0) == 0)
+                {
+                    shards.insert(QString::fromStdString(path));
+                }
+            }
+
+            bool isFolderChange = pending.contains(PURCHASE_FOLDER_NAME);
+
+            for (const QString& path : shards)
+            {
+                if (!isFolderChange && !pending.contains(path))
+                {
+                    continue;
+                }
+
+                if (!didChange(path.toStdString()))
+                {
+                    continue;
+                }
+
+                bool isNumber = false;
+                std::uint32_t accountId = QFileInfo(path).completeBaseName().toUInt(&isNumber);
+
+                if (!isNumber)
+                {
+                    continue;
+                }
+
+                emit onShardChange(accountId);
+            }
+        }
+
+        void Watcher::watch()
+        {
+            QStringList paths = { USER_FILE_NAME, ACCOUNT_FILE_NAME, PURCHASE_FOLDER_NAME };
+            paths.append(getShardPaths());
+
+            QStringList watched = m_watcher.files() + m_watcher.directories();
+            QStringList missing {};
+
+            for (const QString& path : paths)
+            {
+                if (watched.contains(path) || !QFileInfo::exists(path))
+                {
+                    continue;
+                }
+
+                missing.push_back(path);
+            }
+
+            if (missing.isEmpty())
+            {
+                return;
+            }
+
+            m_watcher.addPaths(missing);
+        }
+
+        bool Watcher::didChange(const std::string& inPath)
+        {
+            FileSystem::FileStatus status = FileSystem::getFileStatus(inPath);
+
+            if (!status.exists)
+            {
+                return m_stamps.erase(inPath) > 0;
+            }
+
+            Stamp& stamp = m_stamps[inPath];
+
+            qint64 modified = status.modified;
+            qint64 size     = (qint64) status.size;
+
+            if (stamp.modified == modified && stamp.size == size)
+            {
+                return false;
+            }
+
+            FileSystem::MappedFile content(inPath);
+            std::size_t hash = std::hash<std::string_view>{}(content.getView());
+
+            bool result = stamp.hash != hash || stamp.size < 0;
+
+            stamp.modified = modified;
+            stamp.size     = size;
+            stamp.hash     = hash;
+
+            return result;
+        }
+
+        QStringList Watcher::getShardPaths()
+        {
+            QStringList result {};
+
+            QDir folder(PURCHASE_FOLDER_NAME);
+
+            for (const QString& name : folder.entryList({ "*.json" }, QDir::Files))
+            {
+                if (name == QFileInfo(PURCHASE_MANIFEST_FILE_NAME).fileName())
+                {
+                    continue;
+                }
+
+                result.push_back(folder.filePath(name));
+            }
+
+            return result;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include <QtCore>
+#include <QFileSystemWatcher>
+
+#include <nlohmann/json.hpp>
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Key order independent, what the reload compares stored entities by
+        std::size_t getContentHash(const nlohmann::json& inData);
+
+        // Reports external edits to Data/, batched so a sync tool writing several files triggers one reload each
+        class Watcher : public QObject
+        {
+            Q_OBJECT
+
+        public:
+            static constexpr int DEBOUNCE_INTERVAL = 250;
+
+        signals:
+            void onUsersChange();
+            void onAccountsChange();
+            void onShardChange(std::uint32_t inAccountId);
+
+        public:
+            Watcher(QObject* parent = nullptr);
+            ~Watcher() = default;
+
+        public:
+            // Snapshots the current files so only later edits are reported
+            void start();
+
+            // Called after the app wrote inPath itself, so the write isn't reported back as an edit
+            void acknowledge(const std::string& inPath);
+
+        private:
+            struct Stamp
+            {
+                qint64 modified  = -1;
+                qint64 size      = -1;
+                std::size_t hash = 0;
+            };
+
+        private:
+            void schedule(const QString& inPath);
+            void flush();
+
+            void watch();
+
+            // Cheap stat first, the content hash only when it moved; false for rewrites of the same bytes
+            bool didChange(const std::string& inPath);
+
+            QStringList getShardPaths();
+
+        private:
+            QFileSystemWatcher m_watcher;
+            QTimer m_timer;
+
+            std::map<std::string, Stamp> m_stamps;
+            QSet<QString> m_pending;
+        };
+    }
+}
@@ -0,0 +1,397 @@
+#include "Storage/Writer.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace Financy
+{
+    namespace Storage
+    {
+        Writer::Writer(const std::string& inFilepath, bool isCompact)
+            : m_stream(inFilepath, std::ios::binary | std::ios::trunc),
+            m_isCompact(isCompact),
+            m_isKeyPending(false),
+            m_scopes({}),
+            m_size(0)
+        {
+        }
+
+        Writer::~Writer()
+        {
+            close();
+        }
+
+        bool Writer::isOpen() const
+        {
+            return m_stream.is_open();
+        }
+
+        void Writer::beginArray()
+        {
+            beginScope('[', true);
+        }
+
+        void Writer::endArray()
+        {
+            endScope(']');
+        }
+
+        void Writer::beginObject()
+        {
+            beginScope('{', false);
+        }
+
+        void Writer::endObject()
+        {
+            endScope('}');
+        }
+
+        Writer& Writer::key(const char* inKey)
+        {
+            beginValue();
+
+            put('"');
+            put(inKey, std::strlen(inKey));
+            put('"');
+            put(':');
+
+            if (!m_isCompact)
+            {
+                put(' ');
+            }
+
+            m_isKeyPending = true;
+
+            return *this;
+        }
+
+        void Writer::value(std::uint32_t inValue)
+        {
+            value((std::int64_t) inValue);
+        }
+
+        void Writer::value(int inValue)
+        {
+            value((std::int64_t) inValue);
+        }
+
+        void Writer::value(std::int64_t inValue)
+        {
+            beginValue();
+
+            char buffer[24];
+            auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), inValue);
+
+            put(buffer, end - buffer);
+        }
+
+        void Writer::value(float inValue)
+        {
+            beginValue();
+
+            // Stored as a double, like nlohmann does for a float member
+            double number = inValue;
+
+            if (!std::isfinite(number))
+            {
+                put("null", 4);
+
+                return;
+            }
+
+            char buffer[32];
+            auto [end, error] = std::to_chars(buffer, buffer + sizeof(buffer), number);
+
+            put(buffer, end - buffer);
+
+            // Integral values keep a fraction so they read back as floats
+            if (std::find_if(buffer, end, [](char _) { return _ == '.' || _ == 'e'; }) == end)
+            {
+                put(".0", 2);
+            }
+        }
+
+        void Writer::value(bool inValue)
+        {
+            beginValue();
+
+            if (inValue)
+            {
+                put("true", 4);
+
+                return;
+            }
+
+            put("false", 5);
+        }
+
+        void Writer::value(const QString& inValue)
+        {
+            constexpr const char* HEX = "0123456789abcdef";
+
+            beginValue();
+
+            put('"');
+
+            const QChar* data = inValue.constData();
+            const qsizetype size = inValue.size();
+
+            // UTF-16 to UTF-8 straight into the buffer
+            for (qsizetype i = 0; i < size; i++)
+            {
+                char32_t code = data[i].unicode();
+
+                if (data[i].isHighSurrogate() && i + 1 < size && data[i + 1].isLowSurrogate())
+                {
+                    code = QChar::surrogateToUcs4(data[i], data[i + 1]);
+
+                    i++;
+                }
+
+                switch (code)
+                {
+                    case '"':  put("\\\"", 2); continue;
+                    case '\\': put("\\\\", 2); continue;
+                    case '\b': put("\\b", 2);  continue;
+                    case '\f': put("\\f", 2);  continue;
+                    case '\n': put("\\n", 2);  continue;
+                    case '\r': put("\\r", 2);  continue;
+                    case '\t': put("\\t", 2);  continue;
+                    default: break;
+                }
+
+                if (code < 0x20)
+                {
+                    char escaped[6] = { '\\', 'u', '0', '0', HEX[code >> 4], HEX[code & 0xF] };
+
+                    put(escaped, 6);
+
+                    continue;
+                }
+
+                if (code < 0x80)
+                {
+                    put((char) code);
+
+                    continue;
+                }
+
+                if (code < 0x800)
+                {
+                    put((char) (0xC0 | (code >> 6)));
+                    put((char) (0x80 | (code & 0x3F)));
+
+                    continue;
+                }
+
+                if (code < 0x10000)
+                {
+                    put((char) (0xE0 | (code >> 12)));
+                    put((char) (0x80 | ((code >> 6) & 0x3F)));
+                    put((char) (0x80 | (code & 0x3F)));
+
+                    continue;
+                }
+
+                put((char) (0xF0 | (code >> 18)));
+                put((char) (0x80 | ((code >> 12) & 0x3F)));
+                put((char) (0x80 | ((code >> 6) & 0x3F)));
+                put((char) (0x80 | (code & 0x3F)));
+            }
+
+            put('"');
+        }
+
+        void Writer::value(const QDate& inDate)
+        {
+            beginValue();
+
+            // Same as QDate::toString, which gives nothing for an invalid date
+            if (!inDate.isValid())
+            {
+                put("\"\"", 2);
+
+                return;
+            }
+
+            // dd/MM/yyyy, the format every date is stored in. Like Qt, years past four digits are
+            // written whole and negative ones keep four digits after the sign
+            int year = inDate.year();
+
+            char buffer[32];
+            int size = std::snprintf(
+                buffer,
+                sizeof(buffer),
+                year < 0 ? "%02d/%02d/-%04d" : "%02d/%02d/%04d",
+                inDate.day(),
+                inDate.month(),
+                std::abs(year)
+            );
+
+            put('"');
+            put(buffer, std::clamp(size, 0, (int) sizeof(buffer) - 1));
+            put('"');
+        }
+
+        void Writer::value(const QColor& inColor)
+        {
+            constexpr const char* HEX = "0123456789abcdef";
+
+            beginValue();
+
+            const int channels[] = { inColor.red(), inColor.green(), inColor.blue() };
+
+            char buffer[9] = { '"', '#' };
+
+            for (int i = 0; i < 3; i++)
+            {
+                buffer[2 + i * 2]     = HEX[(channels[i] >> 4) & 0xF];
+                buffer[2 + i * 2 + 1] = HEX[channels[i] & 0xF];
+            }
+
+            buffer[8] = '"';
+
+            put(buffer, 9);
+        }
+
+        void Writer::value(const QList<int>& inValues)
+        {
+            beginArray();
+
+            for (int value : inValues)
+            {
+                this->value(value);
+            }
+
+            endArray();
+        }
+
+        void Writer::close()
+        {
+            if (!m_stream.is_open())
+            {
+                return;
+            }
+
+            put('\n');
+
+            flush();
+
+            m_stream.close();
+        }
+
+        void Writer::beginValue()
+        {
+            if (m_isKeyPending)
+            {
+                m_isKeyPending = false;
+
+                return;
+            }
+
+            if (m_scopes.empty())
+            {
+                return;
+            }
+
+            Scope& scope = m_scopes.back();
+
+            if (scope.hasItems)
+            {
+                put(',');
+            }
+
+            scope.hasItems = true;
+
+            newLine();
+        }
+
+        void Writer::beginScope(char inBracket, bool isArray)
+        {
+            beginValue();
+
+            put(inBracket);
+
+            m_scopes.push_back({ isArray, false });
+        }
+
+        void Writer::endScope(char inBracket)
+        {
+            if (m_scopes.empty())
+            {
+                return;
+            }
+
+            bool hasItems = m_scopes.back().hasItems;
+
+            m_scopes.pop_back();
+
+            // Empty containers stay on one line, as "[]" and "{}"
+            if (hasItems)
+            {
+                newLine();
+            }
+
+            put(inBracket);
+        }
+
+        void Writer::newLine()
+        {
+            if (m_isCompact)
+            {
+                return;
+            }
+
+            put('\n');
+
+            for (std::size_t i = 0; i < m_scopes.size() * INDENT; i++)
+            {
+                put(' ');
+            }
+        }
+
+        void Writer::put(char inCharacter)
+        {
+            if (m_size == BUFFER_SIZE)
+            {
+                flush();
+            }
+
+            m_buffer[m_size++] = inCharacter;
+        }
+
+        void Writer::put(const char* inData, std::size_t inSize)
+        {
+            while (inSize > 0)
+            {
+                if (m_size == BUFFER_SIZE)
+                {
+                    flush();
+                }
+
+                std::size_t count = std::min(inSize, BUFFER_SIZE - m_size);
+
+                std::memcpy(m_buffer + m_size, inData, count);
+
+                m_size += count;
+                inData += count;
+                inSize -= count;
+            }
+        }
+
+        void Writer::flush()
+        {
+            if (m_size == 0)
+            {
+                return;
+            }
+
+            m_stream.write(m_buffer, m_size);
+
+            m_size = 0;
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <QtCore>
+#include <QColor>
+
+namespace Financy
+{
+    namespace Storage
+    {
+        // Streams JSON straight into a fixed buffer flushed to the file as it fills, entities write their own
+        // fields so there is no document tree and no per field string copies in between
+        class Writer
+        {
+        public:
+            static constexpr std::size_t BUFFER_SIZE = 1 << 16;
+            static constexpr std::uint32_t INDENT    = 4;
+
+        public:
+            // Pretty printing matches what nlohmann's setw(4) produced, so stored files don't churn
+            Writer(const std::string& inFilepath, bool isCompact = false);
+            ~Writer();
+
+            Writer(const Writer&) = delete;
+            Writer& operator=(const Writer&) = delete;
+
+        public:
+            bool isOpen() const;
+
+            void beginArray();
+            void endArray();
+
+            void beginObject();
+            void endObject();
+
+            // inKey is written as is, only pass plain ASCII literals
+            Writer& key(const char* inKey);
+
+            void value(std::uint32_t inValue);
+            void value(std::int64_t inValue);
+            void value(int inValue);
+            void value(float inValue);
+            void value(bool inValue);
+            void value(const QString& inValue);
+            void value(const QDate& inDate);
+            void value(const QColor& inColor);
+            void value(const QList<int>& inValues);
+
+            // Writes what is buffered and the trailing newline, also done on destruction
+            void close();
+
+        private:
+            struct Scope
+            {
+                bool isArray  = false;
+                bool hasItems = false;
+            };
+
+        private:
+            void beginValue();
+            void beginScope(char inBracket, bool isArray);
+            void endScope(char inBracket);
+
+            void newLine();
+
+            void put(char inCharacter);
+            void put(const char* inData, std::size_t inSize);
+
+            void flush();
+
+        private:
+            std::ofstream m_stream;
+            bool m_isCompact;
+            bool m_isKeyPending;
+
+            std::vector<Scope> m_scopes;
+
+            char m_buffer[BUFFER_SIZE];
+            std::size_t m_size;
+        };
+    }
+}
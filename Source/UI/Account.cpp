@@ -10,8 +10,14 @@
 #include "Core/FileSystem.hpp"
 #include "Core/Globals.hpp"
 #include "Core/Helper.hpp"
+#include "Core/Journal.hpp"
+#include "Core/Snapshot.hpp"
+#include "Storage/Importer.hpp"
+#include "Storage/Watcher.hpp"
+#include "Storage/Writer.hpp"
 #include "UI/User.hpp"
 #include "UI/Internal.hpp"
+#include "UI/Simulation.hpp"
 
 namespace Financy
 {
@@ -25,16 +31,12 @@ namespace Financy
         m_type(Type::Expense),
         m_limit(1.0f),
         m_primaryColor("#FFFFFF"),
-        m_secondaryColor("#000000")
-    {
-        qmlRegisterUncreatableType<Account>(
-            "Financy.Types",
-            1,
-            0,
-            "Account",
-            "Internal use only"
-        );
-    }
+        m_secondaryColor("#000000"),
+        m_historyModel(new HistoryModel(this)),
+        m_simulation(nullptr),
+        m_snapshot(nullptr),
+        m_isSnapshotDirty(true)
+    {}
 
     Account::Type Account::getTypeValue(const QString& inName)
     {
@@ -143,9 +145,76 @@ namespace Financy
         };
     }
 
-    const QList<Statement*>& Account::getHistory()
+    void Account::write(Storage::Writer& outWriter)
+    {
+        outWriter.beginObject();
+        outWriter.key("id").value(            m_id);
+        outWriter.key("userId").value(        m_userId);
+        outWriter.key("sharedUserIds").value( m_sharedUserIds);
+        outWriter.key("name").value(          m_name);
+        outWriter.key("closingDay").value(    m_closingDay);
+        outWriter.key("type").value(          (int) m_type);
+        outWriter.key("limit").value(         m_limit);
+        outWriter.key("primaryColor").value(  m_primaryColor);
+        outWriter.key("secondaryColor").value(m_secondaryColor);
+        outWriter.endObject();
+    }
+
+    void Account::fromData(const AccountData& inData)
     {
-        return m_history;
+        setId(            inData.id);
+        setUserId(        inData.userId);
+        setSharedUserIds( inData.sharedUserIds);
+        setName(          inData.name);
+        setClosingDay(    inData.closingDay);
+        setType(          inData.type);
+        setLimit(         inData.limit);
+        setPrimaryColor(  inData.primaryColor);
+        setSecondaryColor(inData.secondaryColor);
+    }
+
+    AccountData Account::toData()
+    {
+        AccountData result;
+        result.id             = m_id;
+        result.userId         = m_userId;
+        result.sharedUserIds  = m_sharedUserIds;
+        result.name           = m_name;
+        result.closingDay     = m_closingDay;
+        result.type           = m_type;
+        result.limit          = m_limit;
+        result.primaryColor   = m_primaryColor;
+        result.secondaryColor = m_secondaryColor;
+
+        return result;
+    }
+
+    bool AccountData::operator==(const AccountData& inOther) const
+    {
+        return id == inOther.id &&
+            userId == inOther.userId &&
+            sharedUserIds == inOther.sharedUserIds &&
+            name == inOther.name &&
+            closingDay == inOther.closingDay &&
+            type == inOther.type &&
+            limit == inOther.limit &&
+            primaryColor == inOther.primaryColor &&
+            secondaryColor == inOther.secondaryColor &&
+            purchases == inOther.purchases;
+    }
+
+    std::size_t AccountData::getSize() const
+    {
+        std::size_t result = sizeof(AccountData) +
+            name.size() * sizeof(QChar) +
+            sharedUserIds.size() * sizeof(int);
+
+        for (const PurchaseData& purchase : purchases)
+        {
+            result += purchase.getSize();
+        }
+
+        return result;
     }
 
     bool Account::isOwnedBy(User* inUser)
@@ -211,7 +280,7 @@ namespace Financy
             newShareUserIds.push_back(id);
         }
 
-        std::vector<std::uint32_t> userPurchases {};
+        QList<std::uint32_t> userPurchases {};
 
         for (Purchase* purchase : getPurchases())
         {
@@ -221,7 +290,11 @@ namespace Financy
         for (std::uint32_t purchaseId : userPurchases)
         {
             deletePurchaseFromMemory(purchaseId);
-            deletePurchaseFromFile(purchaseId);
+        }
+
+        if (!userPurchases.empty())
+        {
+            deletePurchases(userPurchases);
         }
 
         setSharedUserIds(newShareUserIds);
@@ -229,22 +302,12 @@ namespace Financy
 
     bool Account::hasFullyPaid(Purchase* inPurchase)
     {
-        QDate now = Globals::getCurrentDate();
-
-        return inPurchase->isFullyPaid(
-            now,
-            getClosingDay(now)
-        );
+        return hasFullyPaid(Internal::getContext(), inPurchase);
     }
 
     std::uint32_t Account::getPaidInstallments(Purchase* inPurchase)
     {
-        QDate now = Globals::getCurrentDate();
-
-        return inPurchase->getPaidInstallments(
-            now,
-            getClosingDay(now)
-        );
+        return getPaidInstallments(Internal::getContext(), inPurchase);
     }
     
     std::uint32_t Account::getPaidInstallments(Purchase* inPurchase, const QDate& inStatementDate)
@@ -256,22 +319,45 @@ namespace Financy
     }
 
     std::uint32_t Account::getRemainingInstallments(Purchase* inPurchase)
+    {
+        return getRemainingInstallments(Internal::getContext(), inPurchase);
+    }
+
+    float Account::getRemainingValue(Purchase* inPurchase)
+    {
+        return getRemainingValue(Internal::getContext(), inPurchase);
+    }
+
+    bool Account::hasFullyPaid(const Context& inContext, Purchase* inPurchase)
+    {
+        return inPurchase->isFullyPaid(
+            inContext.asOf,
+            getClosingDay(inContext.asOf)
+        );
+    }
+
+    std::uint32_t Account::getPaidInstallments(const Context& inContext, Purchase* inPurchase)
+    {
+        return getPaidInstallments(inPurchase, inContext.asOf);
+    }
+
+    std::uint32_t Account::getRemainingInstallments(const Context& inContext, Purchase* inPurchase)
     {
         return std::clamp(
-            inPurchase->getInstallments() - getPaidInstallments(inPurchase),
+            inPurchase->getInstallments() - getPaidInstallments(inContext, inPurchase),
             (std::uint32_t) 0,
             inPurchase->getInstallments()
         );
     }
 
-    float Account::getRemainingValue(Purchase* inPurchase)
+    float Account::getRemainingValue(const Context& inContext, Purchase* inPurchase)
     {
-        if (hasFullyPaid(inPurchase))
+        if (hasFullyPaid(inContext, inPurchase))
         {
             return 0;
         }
 
-        return inPurchase->getValue() - (inPurchase->getInstallmentValue() * (getPaidInstallments(inPurchase) - 1));
+        return inPurchase->getValue() - (inPurchase->getInstallmentValue() * (getPaidInstallments(inContext, inPurchase) - 1));
     }
 
     void Account::createPurchase(
@@ -290,23 +376,7 @@ namespace Financy
             return;
         }
 
-        std::ifstream file(PURCHASE_FILE_NAME);
-        nlohmann::ordered_json purchases = FileSystem::doesFileExist(PURCHASE_FILE_NAME) ? 
-            nlohmann::ordered_json::parse(file):
-            nlohmann::ordered_json::array();
-
-        if (!purchases.is_array())
-        {
-            return;
-        }
-
-        std::uint32_t id = 0;
-
-        if (purchases.size() > 0)
-        {
-            id = (std::uint32_t) purchases[purchases.size() - 1].at("id");
-            id++;
-        }
+        std::uint32_t id = Internal::getRepository().allocatePurchaseIds();
 
         Purchase* purchase = new Purchase();
         purchase->setId(          id);
@@ -321,11 +391,13 @@ namespace Financy
 
         m_purchases.push_back(purchase);
 
+        Internal::getSearchIndex().add(purchase);
+
         sortPurchases();
 
         refreshHistory();
 
-        writePurchases();
+        savePurchases({ purchase });
     }
 
     void Account::editPurchase(
@@ -359,11 +431,13 @@ namespace Financy
             inInstallments.toInt()
         );
 
+        Internal::getSearchIndex().add(foundPurchase);
+
         sortPurchases();
 
         refreshHistory();
 
-        writePurchases();
+        savePurchases({ foundPurchase });
     }
 
     void Account::cancelPurchase(std::uint32_t inId)
@@ -378,18 +452,34 @@ namespace Financy
         purchase->setEndDate(Globals::getCurrentDate());
         purchase->setHasEnded(true);
 
+        invalidatePurchases();
+
         refreshHistory();
 
         emit onEdit();
 
-        writePurchases();
+        savePurchases({ purchase });
     }
 
     void Account::deletePurchase(std::uint32_t inId)
     {
+        Purchase* purchase = getPurchase(inId);
+
+        if (purchase != nullptr)
+        {
+            User* user = Internal::getSelectedUser();
+
+            Change change;
+            change.type      = Change::Type::DeletePurchases;
+            change.userId    = user != nullptr ? user->getId() : m_userId;
+            change.accountId = m_id;
+            change.purchases = { purchase->toData() };
+
+            Internal::getJournal()->record(std::move(change));
+        }
+
         int userCount = m_purchases.size();
 
-        deletePurchaseFromFile(  inId);
         deletePurchaseFromMemory(inId);
 
         if (userCount == m_purchases.size())
@@ -399,184 +489,276 @@ namespace Financy
             return;
         }
 
+        deletePurchases({ inId });
+
         refreshHistory();
     }
 
-    QList<Statement*> Account::getStatementPurchases(const QDate& inDate, int inUserId)
+    int Account::importPurchases(const QString& inFileUrl)
     {
-        QList<Statement*> result{};
+        User* user = Internal::getSelectedUser();
 
-        for (Purchase* purchase : getPurchases(inDate, inUserId))
+        if (user == nullptr)
         {
-            if (purchase->isRecurring())
-            {
-                continue;
-            }
-
-            auto foundItem = std::find_if(
-                result.begin(),
-                result.end(),
-                [purchase](Statement* _) { return _->getDate().daysTo(purchase->getDate()) == 0; }
-            );
+            return 0;
+        }
 
-            int foundIndex = foundItem - result.begin();
+        QUrl url(inFileUrl);
 
-            if (foundItem == result.end())
-            {
-                foundIndex = result.size();
+        std::vector<Storage::Import::Row> rows = Storage::Import::read(
+            (url.isLocalFile() ? url.toLocalFile() : inFileUrl).toStdString()
+        );
 
-                result.push_back(new Statement());
+        // The batch is written next to the stored purchases, not over them
+        refreshPurchases();
 
-                result[foundIndex]->setDate(     purchase->getDate());
-                result[foundIndex]->setPurchases({});
-            }
+        const Search::FingerprintCounts& existing = getFingerprints();
+        Search::FingerprintCounts seen {};
 
-            QList<Purchase*> purchases = result[foundIndex]->getPurchases();
-            purchases.push_back(purchase);
+        rows.erase(
+            std::remove_if(
+                rows.begin(),
+                rows.end(),
+                [&](const Storage::Import::Row& inRow)
+                {
+                    std::uint64_t fingerprint = Search::getFingerprint(
+                        inRow.date,
+                        inRow.name,
+                        inRow.value,
+                        inRow.installments,
+                        user->getId()
+                    );
+
+                    return Search::isDuplicate(fingerprint, existing, seen);
+                }
+            ),
+            rows.end()
+        );
 
-            result[foundIndex]->setPurchases(purchases);
-            result[foundIndex]->setDueAmount(result[foundIndex]->getDueAmount() + purchase->getInstallmentValue());
+        if (rows.empty())
+        {
+            return 0;
         }
 
-        return result;
-    }
+        std::uint32_t id = Internal::getRepository().allocatePurchaseIds(rows.size());
 
-    QList<Purchase*> Account::getStatementSubscriptions(const QDate& inDate, int inUserId)
-    {
-        QList<Purchase*> result{};
+        QList<Purchase*> purchases {};
+        purchases.reserve(rows.size());
 
-        for (Purchase* purchase : getPurchases(inDate, inUserId))
+        for (Storage::Import::Row& row : rows)
         {
-            if (!purchase->isRecurring())
+            Purchase* purchase = new Purchase();
+            purchase->setId(          id++);
+            purchase->setUserId(      user->getId());
+            purchase->setAccountId(   m_id);
+            purchase->setName(        row.name);
+            purchase->setDescription( row.description);
+            purchase->setDate(        row.date);
+            purchase->setType(        row.type);
+            purchase->setValue(       row.value);
+            purchase->setInstallments(row.installments);
+
+            // A statement line is a single charge, even when its category is a recurring one
+            if (purchase->isRecurring())
             {
-                continue;
+                purchase->setHasEnded(true);
+                purchase->setEndDate( row.date.addMonths(1));
             }
 
-            result.push_back(purchase);
+            purchases.push_back(purchase);
         }
 
-        return result;
+        addPurchases(purchases);
+
+        savePurchases(purchases);
+
+        return purchases.size();
     }
 
-    void Account::refreshPurchases()
+    void Account::restorePurchases(const QList<Purchase*>& inPurchases)
     {
-        if (m_didFetchPurchases)
-        {
-            return;
-        }
+        refreshPurchases();
 
-        if (!FileSystem::doesFileExist(PURCHASE_FILE_NAME))
-        {
-            return;
-        }
+        addPurchases(inPurchases);
+
+        savePurchases(inPurchases);
+    }
 
-        nlohmann::json purchases = nlohmann::json::parse(std::ifstream(PURCHASE_FILE_NAME));
+    void Account::reloadPurchases(const QList<Purchase*>& inStored)
+    {
+        std::unordered_map<std::uint32_t, Purchase*> stored {};
 
-        if (!purchases.is_array())
+        for (Purchase* purchase : inStored)
         {
-            return;
+            stored[purchase->getId()] = purchase;
         }
 
-        QList<Purchase*> newPurchases {};
+        QList<std::uint32_t> removed {};
 
-        for (auto& [key, data] : purchases.items())
+        for (Purchase* purchase : m_purchases)
         {
-            if (
-                data.find("accountId") == data.end() ||
-                data.find("userId") == data.end()
-            )
+            auto iterator = stored.find(purchase->getId());
+
+            if (iterator == stored.end())
             {
+                removed.push_back(purchase->getId());
+
                 continue;
             }
 
-            if ((std::uint32_t) data.at("accountId") != m_id)
+            // Edited rows are swapped for the stored copy
+            if (
+                Storage::getContentHash(purchase->toJSON()) !=
+                Storage::getContentHash(iterator->second->toJSON())
+            )
             {
+                removed.push_back(purchase->getId());
+
                 continue;
             }
 
-            Purchase* purchase = new Purchase();
-            purchase->fromJSON(data);
+            delete iterator->second;
 
-            newPurchases.push_back(purchase);
+            stored.erase(iterator);
         }
 
-        setPurchases(newPurchases);
+        if (removed.isEmpty() && stored.empty())
+        {
+            return;
+        }
 
-        m_didFetchPurchases = true;
-    }
+        for (std::uint32_t id : removed)
+        {
+            deletePurchaseFromMemory(id);
+        }
 
-    void Account::clearPurchases()
-    {
-        m_purchases.clear();
+        // Unchanged rows were freed above, only what is left in the map is still alive
+        QList<Purchase*> added {};
 
-        emit onEdit();
+        for (auto& [id, purchase] : stored)
+        {
+            added.push_back(purchase);
+        }
+
+        if (added.isEmpty())
+        {
+            refreshHistory();
+
+            return;
+        }
+
+        addPurchases(added);
     }
 
-    void Account::refreshHistory(int inUserId)
+    Simulation* Account::simulate()
     {
-        m_history.clear();
+        refreshPurchases();
 
-        QList<Purchase*> purchases = getPurchases();
-
-        if (purchases.isEmpty())
+        if (m_simulation != nullptr)
         {
-            return;
+            m_simulation->discard();
+
+            return m_simulation;
         }
 
-        QDate earliestStatement    = getEarliestStatementDate(inUserId);
-        QDate latestStatement      = getLatestStatementDate(inUserId);
-        QDate currentStatementDate = earliestStatement;
+        m_simulation = new Simulation(this, this);
 
-        while(latestStatement.daysTo(currentStatementDate) <= 0)
-        {
-            Statement* statement = new Statement();
-            statement->setDate(currentStatementDate);
+        QQmlEngine::setObjectOwnership(m_simulation, QQmlEngine::CppOwnership);
 
-            float purchaseDueAmount  = 0.0f;
-            float recurringDueAmount = 0.0f;
+        return m_simulation;
+    }
 
-            for (Purchase* purchase : getPurchases(currentStatementDate, inUserId))
-            {
-                if (purchase->isRecurring())
-                {
-                    recurringDueAmount += purchase->getInstallmentValue();
+    QList<Statement*> Account::getStatementPurchases(const QDate& inDate, int inUserId)
+    {
+        QList<Statement*> result{};
 
-                    continue;
-                }
- 
-                purchaseDueAmount += purchase->getInstallmentValue();
-            }
+        // The last listing is replaced, the one before it can't be on screen anymore
+        m_statements.beginGeneration();
+
+        Search::Query query;
+        query.statementDate = inDate;
+        query.userId        = inUserId;
+        query.recurrence    = Search::Query::Recurrence::Exclude;
+        query.isDescending  = true;
 
-            currentStatementDate = QDate(
-                currentStatementDate.year(),
-                currentStatementDate.month(),
-                getClosingDay(currentStatementDate)
+        for (Purchase* purchase : getPurchases(query))
+        {
+            auto foundItem = std::find_if(
+                result.begin(),
+                result.end(),
+                [purchase](Statement* _) { return _->getDate().daysTo(purchase->getDate()) == 0; }
             );
-            currentStatementDate = currentStatementDate.addMonths(1);
 
-            bool isFirstEmpty = purchaseDueAmount == 0 && recurringDueAmount == 0 && m_history.size() == 0;
-            bool isLastEmpty  = purchaseDueAmount == 0 && latestStatement.daysTo(currentStatementDate) > 0;
+            int foundIndex = foundItem - result.begin();
 
-            if (isFirstEmpty || isLastEmpty)
+            if (foundItem == result.end())
             {
-                delete statement;
+                foundIndex = result.size();
 
-                continue;
+                result.push_back(m_statements.create());
+
+                result[foundIndex]->setDate(     purchase->getDate());
+                result[foundIndex]->setPurchases({});
             }
 
-            statement->setDueAmount(purchaseDueAmount + recurringDueAmount);
+            QList<Purchase*> purchases = result[foundIndex]->getPurchases();
+            purchases.push_back(purchase);
 
-            m_history.push_back(statement);
+            result[foundIndex]->setPurchases(purchases);
+            result[foundIndex]->setDueAmount(result[foundIndex]->getDueAmount() + purchase->getInstallmentValue());
         }
 
-        sortHistory();
+        return result;
+    }
+
+    QList<Purchase*> Account::getStatementSubscriptions(const QDate& inDate, int inUserId)
+    {
+        Search::Query query;
+        query.statementDate = inDate;
+        query.userId        = inUserId;
+        query.recurrence    = Search::Query::Recurrence::Only;
+        query.isDescending  = true;
+
+        return getPurchases(query);
+    }
+
+    void Account::refreshPurchases()
+    {
+        if (m_didFetchPurchases)
+        {
+            return;
+        }
+
+        setPurchases(Internal::getRepository().readPurchases(m_id));
+
+        m_didFetchPurchases = true;
+    }
+
+    void Account::clearPurchases()
+    {
+        m_purchases.clear();
+        invalidatePurchases();
+
+        Internal::getSearchIndex().removeAccount(m_id);
+
+        emit onEdit();
+    }
+
+    void Account::refreshHistory(int inUserId)
+    {
+        refreshHistory(Internal::getContext(), inUserId);
+    }
+
+    void Account::refreshHistory(const Context& inContext, int inUserId)
+    {
+        m_historyModel->refresh(this, inContext, inUserId);
 
         emit onEdit();
     }
 
     void Account::clearHistory()
     {
-        m_history.clear();
+        m_historyModel->clear();
 
         emit onEdit();
     }
@@ -588,17 +770,27 @@ namespace Financy
 
     float Account::getDueAmount(int inUserId)
     {
-        return getDueAmount(Globals::getCurrentDate(), inUserId);
+        return getDueAmount(Internal::getContext(), inUserId);
     }
 
     float Account::getDueAmount(const QDate& inDate, int inUserId)
+    {
+        return getDueAmount(Internal::getContext().at(inDate), inUserId);
+    }
+
+    float Account::getDueAmount(const Context& inContext, int inUserId)
     {
         float result = 0.0f;
 
-        for(Purchase* purchase : getPurchases(inDate, inUserId))
-        {
-            result += purchase->getInstallmentValue();
-        }
+        Search::Query query;
+        query.statementDate = inContext.asOf;
+        query.userId        = inUserId;
+
+        forEachPurchase(
+            inContext,
+            query,
+            [&result](Purchase* inPurchase) { result += inPurchase->getInstallmentValue(); }
+        );
 
         return result;
     }
@@ -610,36 +802,79 @@ namespace Financy
 
     float Account::getUsedLimit(int inUserId)
     {
-        return getUsedLimit(Globals::getCurrentDate(), inUserId);
+        return getUsedLimit(Internal::getContext(), inUserId);
     }
 
     float Account::getUsedLimit(const QDate& inDate, int inUserId)
+    {
+        return getUsedLimit(Internal::getContext().at(inDate), inUserId);
+    }
+
+    float Account::getUsedLimit(const Context& inContext, int inUserId)
     {
         float result = 0.0f;
 
+        // The limit is shared, every user's purchases hold part of it
         for (Purchase* purchase : m_purchases)
         {
-            if (purchase->getDate().daysTo(inDate) < 0)
-            {
-                continue;
-            }
+            result += getLimitUsage(inContext, purchase);
+        }
 
-            if (purchase->getType() == Purchase::Type::Subscription || purchase->getType() == Purchase::Type::Bill)
-            {
-                result += purchase->getValue();
+        return result;
+    }
 
-                continue;
-            }
+    float Account::getLimitUsage(const Context& inContext, Purchase* inPurchase)
+    {
+        if (inPurchase->getDate().daysTo(inContext.asOf) < 0)
+        {
+            return 0.0f;
+        }
+
+        if (inPurchase->getType() == Purchase::Type::Subscription || inPurchase->getType() == Purchase::Type::Bill)
+        {
+            return inPurchase->getValue();
+        }
 
-            if (hasFullyPaid(purchase))
+        if (hasFullyPaid(inContext, inPurchase))
+        {
+            return 0.0f;
+        }
+
+        return getRemainingValue(inContext, inPurchase);
+    }
+
+    void Account::applyChanges(const QList<Purchase*>& inAdded, const QList<std::uint32_t>& inRemovedIds)
+    {
+        if (inAdded.isEmpty() && inRemovedIds.isEmpty())
+        {
+            return;
+        }
+
+        refreshPurchases();
+
+        for (std::uint32_t id : inRemovedIds)
+        {
+            deletePurchaseFromMemory(id);
+        }
+
+        if (!inAdded.isEmpty())
+        {
+            std::uint32_t id = Internal::getRepository().allocatePurchaseIds(inAdded.size());
+
+            for (Purchase* purchase : inAdded)
             {
-                continue;
+                purchase->setId(id++);
             }
-    
-            result += getRemainingValue(purchase);
+
+            // Sorts, indexes and rebuilds the history once
+            addPurchases(inAdded);
+        }
+        else
+        {
+            refreshHistory();
         }
 
-        return result;
+        applyPurchases(inAdded, inRemovedIds);
     }
 
     std::uint32_t Account::getId()
@@ -730,24 +965,48 @@ namespace Financy
 
     QList<Purchase*> Account::getPurchases(const QDate& inDate, int inUserId)
     {
-        QList<Purchase*> result {};
+        Search::Query query;
+        query.statementDate = inDate;
+        query.userId        = inUserId;
+        query.isDescending  = true;
 
-        for (Purchase* purchase : getPurchases(inUserId))
+        return getPurchases(query);
+    }
+
+    QList<Purchase*> Account::getPurchases(int inUserId)
+    {
+        return getPurchases(Internal::getContext(), inUserId);
+    }
+
+    QList<Purchase*> Account::getPurchases(const Search::Query& inQuery)
+    {
+        return getPurchases(Internal::getContext(), inQuery);
+    }
+
+    void Account::forEachPurchase(const Search::Query& inQuery, const std::function<void(Purchase*)>& inCallback)
+    {
+        forEachPurchase(Internal::getContext(), inQuery, inCallback);
+    }
+
+    QList<Purchase*> Account::getPurchases(const Context& inContext, int inUserId)
+    {
+        bool isOwner = inContext.viewerId >= 0 && isOwnedBy((std::uint32_t) inContext.viewerId);
+
+        if (inUserId < 0 && isOwner)
         {
-            if (purchase == nullptr)
-            {
-                continue;
-            }
+            return m_purchases;
+        }
 
-            std::uint32_t paidInstallments = purchase->getPaidInstallments(
-                inDate,
-                getClosingDay(inDate)
-            );
+        QList<Purchase*> result {};
 
-            bool isPast   = paidInstallments <= 0;
-            bool isFuture = (purchase->isRecurring() && !purchase->hasEnded()) ? false : paidInstallments > purchase->getInstallments();
+        if (inContext.viewerId < 0)
+        {
+            return result;
+        }
 
-            if (isPast || isFuture)
+        for (Purchase* purchase : m_purchases)
+        {
+            if (!purchase->isOwnedBy(inUserId >= 0 ? inUserId : inContext.viewerId))
             {
                 continue;
             }
@@ -755,42 +1014,98 @@ namespace Financy
             result.push_back(purchase);
         }
 
-        std::sort(
-            result.begin(),
-            result.end(),
-            [](Purchase* a, Purchase* b) { return a->getDate().toJulianDay() > b->getDate().toJulianDay(); }
+        return result;
+    }
+
+    QList<Purchase*> Account::getPurchases(const Context& inContext, const Search::Query& inQuery)
+    {
+        QList<Purchase*> result {};
+
+        forEachPurchase(
+            inContext,
+            inQuery,
+            [&result](Purchase* inPurchase) { result.push_back(inPurchase); }
         );
 
         return result;
     }
 
-    QList<Purchase*> Account::getPurchases(int inUserId)
+    void Account::forEachPurchase(
+        const Context& inContext,
+        const Search::Query& inQuery,
+        const std::function<void(Purchase*)>& inCallback
+    )
     {
-        User* user = Internal::getSelectedUser();
+        Search::Query query = inQuery;
+
+        bool isOwner = inContext.viewerId >= 0 && isOwnedBy((std::uint32_t) inContext.viewerId);
 
-        if (inUserId < 0 && isOwnedBy(user))
+        // Same visibility as getPurchases(const Context&, int)
+        if (inQuery.userId >= 0 || !isOwner)
         {
-            return m_purchases;
+            if (inContext.viewerId < 0)
+            {
+                return;
+            }
+
+            query.userId = inQuery.userId >= 0 ? inQuery.userId : inContext.viewerId;
         }
 
-        QList<Purchase*> result {};
+        if (query.statementDate.isValid())
+        {
+            query.statementClosingDay = getClosingDay(query.statementDate);
+        }
 
-        if (user == nullptr)
+        if (m_table.isDirty())
         {
-            return result;
+            m_table.rebuild(m_purchases);
         }
 
-        for (Purchase* purchase : m_purchases)
+        m_table.select(query, inCallback);
+    }
+
+    Search::Rollup Account::getRollup(int inUserId)
+    {
+        return getRollup(Internal::getContext(), inUserId);
+    }
+
+    Search::Rollup Account::getRollup(const Context& inContext, int inUserId)
+    {
+        Search::Rollup result(m_closingDay);
+
+        Search::Query query;
+        query.userId = inUserId;
+
+        forEachPurchase(
+            inContext,
+            query,
+            [&result](Purchase* inPurchase) { result.add(inPurchase); }
+        );
+
+        return result;
+    }
+
+    Snapshot::AccountPtr Account::getSnapshot()
+    {
+        if (m_snapshot != nullptr && !m_isSnapshotDirty && m_snapshot->data == toData())
         {
-            if (!purchase->isOwnedBy(inUserId >= 0 ? inUserId : user->getId()))
-            {
-                continue;
-            }
+            return m_snapshot;
+        }
 
-            result.push_back(purchase);
+        m_snapshot        = Snapshot::build(this, m_snapshot);
+        m_isSnapshotDirty = false;
+
+        return m_snapshot;
+    }
+
+    const Search::FingerprintCounts& Account::getFingerprints()
+    {
+        if (m_table.isDirty())
+        {
+            m_table.rebuild(m_purchases);
         }
 
-        return result;
+        return m_table.getFingerprints();
     }
 
     Purchase* Account::getPurchase(std::uint32_t inId)
@@ -822,6 +1137,8 @@ namespace Financy
     {
         m_purchases = inPurchases;
 
+        Internal::getSearchIndex().add(m_purchases);
+
         sortPurchases();
 
         emit onEdit();
@@ -836,11 +1153,16 @@ namespace Financy
             m_purchases.push_back(purchase);
         }
 
+        Internal::getSearchIndex().add(inPurchases);
+
         sortPurchases();
 
         refreshHistory();
+    }
 
-        writePurchases();
+    bool Account::didFetchPurchases()
+    {
+        return m_didFetchPurchases;
     }
 
     QColor Account::getPrimaryColor()
@@ -913,141 +1235,23 @@ namespace Financy
 
     void Account::remove()
     {
-        removeSelf();
+        // Accounts.json is rewritten by the caller once the account is out of the list
         removePurchases();
     }
 
-    void Account::removeSelf()
-    {
-        if (!FileSystem::doesFileExist(ACCOUNT_FILE_NAME))
-        {
-            return;
-        }
-
-        std::ifstream file(ACCOUNT_FILE_NAME);
-
-        nlohmann::json storedAccounts = nlohmann::json::parse(file);
-
-        if (storedAccounts.size() < 0 || !storedAccounts.is_array())
-        {
-            return;
-        }
-
-        std::uint32_t index  = 0;
-        std::size_t lastSize = storedAccounts.size();
-
-        for (auto& it : storedAccounts.items())
-        {
-            if ((std::uint32_t) it.value().at("id") == m_id)
-            {
-                storedAccounts.erase(index);
-
-                break;
-            }
-
-            index++;
-        }
-
-        if (lastSize == storedAccounts.size())
-        {
-            return;
-        }
-
-        std::ofstream stream(ACCOUNT_FILE_NAME);
-        stream << std::setw(4) << storedAccounts << std::endl;
-    }
-
     void Account::removePurchases()
     {
         for (Purchase* purchase : getPurchases())
         {
-            std::uint32_t id = purchase->getId();
-
-            deletePurchaseFromMemory(id);
-            deletePurchaseFromFile(  id);
+            deletePurchaseFromMemory(purchase->getId());
         }
 
         m_purchases.clear();
-    }
-
-    QDate Account::getEarliestStatementDate(int inUserId)
-    {
-        QList<Purchase*> purchase = getPurchases(inUserId);
-
-        if (purchase.isEmpty())
-        {
-            return Globals::getCurrentDate();
-        }
-
-        QDate earliestPurchaseDate = purchase[0]->getDate();
-        QDate earliestStatementClosingDate(
-            earliestPurchaseDate.year(),
-            earliestPurchaseDate.month(),
-            std::min(
-                (std::uint32_t) earliestPurchaseDate.daysInMonth(),
-                m_closingDay
-            )
-        );
-
-        if (earliestStatementClosingDate.daysTo(earliestPurchaseDate) < 0)
-        {
-            earliestStatementClosingDate = earliestStatementClosingDate.addMonths(-1);
-        }
-
-        return earliestStatementClosingDate;
-    }
-
-    QDate Account::getLatestStatementDate(int inUserId)
-    {
-        QDate now = Globals::getCurrentDate();
-
-        bool isOnlyRecurring = true;
-
-        QList<Purchase*> purchases = getPurchases(inUserId);
-
-        for (Purchase* purchase : purchases)
-        {
-            if (!purchase->isRecurring())
-            {
-                isOnlyRecurring = false;
-
-                break;
-            }
-
-            if (purchase->getEndDate().daysTo(now) < 0)
-            {
-                isOnlyRecurring = false;
-
-                break;
-            }
-        }
-
-        if (isOnlyRecurring)
-        {
-            return QDate(
-                now.year(),
-                now.month(),
-                getClosingDay(now)
-            );
-        }
-
-        QDate currentStatementDate = getEarliestStatementDate();
-
-        for (Purchase* purchase : purchases)
-        {
-            std::uint32_t installments = purchase->getInstallments();
-
-            QDate date = purchase->getDate().addMonths(installments == 1 ? 0 : installments);
-
-            if (currentStatementDate.daysTo(date) < 0)
-            {
-                continue;
-            }
+        invalidatePurchases();
 
-            currentStatementDate = date;
-        }
+        Internal::getSearchIndex().removeAccount(m_id);
 
-        return currentStatementDate;
+        Internal::getRepository().removePurchases(m_id);
     }
 
     void Account::sortPurchases()
@@ -1057,133 +1261,46 @@ namespace Financy
             m_purchases.end(),
             [](Purchase* a, Purchase* b) { return a->getDate().toJulianDay() < b->getDate().toJulianDay(); }
         );
-    }
-
-    void Account::writePurchases()
-    {
-        if (!FileSystem::doesFileExist(PURCHASE_FILE_NAME))
-        {
-            return;
-        }
-
-        std::ifstream file(PURCHASE_FILE_NAME);
-
-        nlohmann::ordered_json purchases = nlohmann::ordered_json::parse(file);
-
-        if (!purchases.is_array())
-        {
-            return;
-        }
-
-        nlohmann::ordered_json newPurchases = nlohmann::ordered_json::array();
-
-        if (purchases.size() == 0)
-        {
-            for (Purchase* purchase : m_purchases)
-            {
-                newPurchases.push_back(purchase->toJSON());
-            }
-        }
-        else
-        {
-            std::vector<std::uint32_t> insertedIds {};
-
-            for (auto& it : purchases.items())
-            {
-                std::uint32_t id = (std::uint32_t) it.value().at("id");
-
-                auto foundPurchase = std::find_if(
-                    m_purchases.begin(),
-                    m_purchases.end(),
-                    [id](Purchase* _) { return _->getId() == id; }
-                );
-
-                if (foundPurchase == m_purchases.end())
-                {
-                    newPurchases.push_back(it.value());
-
-                    continue;
-                }
-
-                insertedIds.push_back(id);
-
-                newPurchases.push_back(m_purchases[foundPurchase - m_purchases.begin()]->toJSON());
-            }
 
-            if (insertedIds.size() != m_purchases.size())
-            {
-                for (Purchase* purchase : m_purchases)
-                {
-                    if (
-                        std::find_if(
-                            insertedIds.begin(),
-                            insertedIds.end(),
-                            [purchase](std::uint32_t _) { return _ == purchase->getId(); }
-                        ) != insertedIds.end()
-                    )
-                    {
-                        continue;
-                    }
-
-                    newPurchases.push_back(purchase->toJSON());
-                }
-            }
-        }
-
-        std::ofstream stream(PURCHASE_FILE_NAME);
-        stream << std::setw(4) << newPurchases << std::endl;
+        invalidatePurchases();
     }
 
-    void Account::sortHistory()
+    void Account::invalidatePurchases()
     {
-        std::sort(
-            m_history.begin(),
-            m_history.end(),
-            [](Statement* a, Statement* b) { return a->getDate().toJulianDay() < b->getDate().toJulianDay(); }
-        );
+        m_table.invalidate();
+
+        m_isSnapshotDirty = true;
     }
 
-    void Account::deletePurchaseFromFile(std::uint32_t inId)
+    void Account::savePurchases(const QList<Purchase*>& inChanged)
     {
-        // Remove from file
-        if (!FileSystem::doesFileExist(PURCHASE_FILE_NAME))
+        // Writing an unfetched account would truncate its shard
+        if (!m_didFetchPurchases)
         {
             return;
         }
 
-        std::ifstream file(PURCHASE_FILE_NAME);
-
-        nlohmann::json storedPurchases = nlohmann::json::parse(file);
+        Internal::getRepository().savePurchases(m_id, inChanged, m_purchases);
+    }
 
-        if (storedPurchases.size() < 0 || !storedPurchases.is_array())
+    void Account::deletePurchases(const QList<std::uint32_t>& inIds)
+    {
+        if (!m_didFetchPurchases)
         {
             return;
         }
 
-        std::uint32_t index  = 0;
-        std::size_t lastSize = storedPurchases.size();
-
-        for (auto& it : storedPurchases.items())
-        {
-            if ((std::uint32_t) it.value().at("id") != inId)
-            {
-                index++;
-
-                continue;
-            }
-
-            storedPurchases.erase(index);
-
-            break;
-        }
+        Internal::getRepository().deletePurchases(m_id, inIds, m_purchases);
+    }
 
-        if (lastSize == storedPurchases.size())
+    void Account::applyPurchases(const QList<Purchase*>& inAdded, const QList<std::uint32_t>& inRemovedIds)
+    {
+        if (!m_didFetchPurchases)
         {
             return;
         }
 
-        std::ofstream stream(PURCHASE_FILE_NAME);
-        stream << std::setw(4) << storedPurchases << std::endl;
+        Internal::getRepository().applyPurchases(m_id, inAdded, inRemovedIds, m_purchases);
     }
 
     void Account::deletePurchaseFromMemory(std::uint32_t inId)
@@ -1199,6 +1316,9 @@ namespace Financy
             return;
         }
 
+        Internal::getSearchIndex().remove(inId);
+
         m_purchases.removeAt(iterator - m_purchases.begin());
+        invalidatePurchases();
     }
 }
\ No newline at end of file
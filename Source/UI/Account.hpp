@@ -1,19 +1,44 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 #include <QColor>
 
 #include <nlohmann/json.hpp>
 
+#include "Base.hpp"
 #include "Purchase.hpp"
+#include "Core/Context.hpp"
 #include "Statement.hpp"
+#include "HistoryModel.hpp"
+#include "Search/Rollup.hpp"
+#include "Search/Table.hpp"
 
 namespace Financy
 {
+    class Simulation;
     class User;
+    struct AccountData;
+
+    namespace Snapshot
+    {
+        struct Account;
+    }
+
+    namespace Storage
+    {
+        class Writer;
+    }
+
     class Account : public QObject
     {
         Q_OBJECT
+        QML_ELEMENT
+        QML_UNCREATABLE("Internal use only")
 
         // Properties
         Q_PROPERTY(
@@ -67,9 +92,9 @@ namespace Financy
             NOTIFY onEdit
         )
         Q_PROPERTY(
-            QList<Statement*> history
-            MEMBER m_history
-            NOTIFY onEdit
+            HistoryModel* historyModel
+            MEMBER m_historyModel
+            CONSTANT
         )
 
         // Stats
@@ -141,6 +166,12 @@ namespace Financy
         void cancelPurchase(std::uint32_t inId);
         void deletePurchase(std::uint32_t inId);
 
+        // Returns how many purchases were imported, rows already stored are skipped
+        int importPurchases(const QString& inFileUrl);
+
+        // What-if overlay over this account, nothing is stored until it is committed
+        Simulation* simulate();
+
         QList<Statement*> getStatementPurchases(const QDate& inDate, int inUserId = -1);
         QList<Purchase*> getStatementSubscriptions(const QDate& inDate, int inUserId = -1);
 
@@ -158,9 +189,38 @@ namespace Financy
         float getUsedLimit(int inUserId);
         float getUsedLimit(const QDate& inDate, int inUserId);
 
+    public:
+        // Slots above evaluate with Internal::getContext(), these don't touch any global state
+        bool hasFullyPaid(const Context& inContext, Purchase* inPurchase);
+        std::uint32_t getPaidInstallments(const Context& inContext, Purchase* inPurchase);
+        std::uint32_t getRemainingInstallments(const Context& inContext, Purchase* inPurchase);
+        float getRemainingValue(const Context& inContext, Purchase* inPurchase);
+
+        void refreshHistory(const Context& inContext, int inUserId = -1);
+
+        float getDueAmount(const Context& inContext, int inUserId = -1);
+        float getUsedLimit(const Context& inContext, int inUserId = -1);
+
+        QList<Purchase*> getPurchases(const Context& inContext, int inUserId = -1);
+        QList<Purchase*> getPurchases(const Context& inContext, const Search::Query& inQuery);
+        void forEachPurchase(
+            const Context& inContext,
+            const Search::Query& inQuery,
+            const std::function<void(Purchase*)>& inCallback
+        );
+        Search::Rollup getRollup(const Context& inContext, int inUserId = -1);
+
+        // Current immutable version, edits since the last call are published first. UI thread only
+        std::shared_ptr<const Snapshot::Account> getSnapshot();
+
     public:
         void fromJSON(const nlohmann::json& inData);
         nlohmann::ordered_json toJSON();
+        void write(Storage::Writer& outWriter);
+
+        // Fields only, purchases are copied separately
+        void fromData(const AccountData& inData);
+        AccountData toData();
 
     public:
         std::uint32_t getId();
@@ -187,9 +247,26 @@ namespace Financy
 
         QList<Purchase*> getPurchases(const QDate& inDate, int inUserId = -1);
         QList<Purchase*> getPurchases(int inUserId = -1);
+        QList<Purchase*> getPurchases(const Search::Query& inQuery);
+        void forEachPurchase(const Search::Query& inQuery, const std::function<void(Purchase*)>& inCallback);
+        const Search::FingerprintCounts& getFingerprints();
+        Search::Rollup getRollup(int inUserId = -1);
+
+        // What inPurchase holds of the limit as of the context's date
+        float getLimitUsage(const Context& inContext, Purchase* inPurchase);
+
+        // Adds and deletes as one batch: one id range, one write, one history rebuild
+        void applyChanges(const QList<Purchase*>& inAdded, const QList<std::uint32_t>& inRemovedIds);
+
+        // Puts back purchases that keep their ids, as undoing a delete does
+        void restorePurchases(const QList<Purchase*>& inPurchases);
+
+        // Takes the stored purchases and applies only the ones whose content differs from memory
+        void reloadPurchases(const QList<Purchase*>& inStored);
         Purchase* getPurchase(std::uint32_t inId);
         void setPurchases(const QList<Purchase*>& inPurchases);
         void addPurchases(const QList<Purchase*>& inPurchases);
+        bool didFetchPurchases();
 
         QColor getPrimaryColor();
         void setPrimaryColor(const QColor& inColor);
@@ -207,24 +284,20 @@ namespace Financy
         );
 
         void remove();
-        void removeSelf();
         void removePurchases();
 
-        // Stats
-        const QList<Statement*>& getHistory();
-
     private:
-        QDate getEarliestStatementDate(int inUserId = -1);
-        QDate getLatestStatementDate(int inUserId = -1);
-
         void sortPurchases();
-        void writePurchases();
-
-        void sortHistory();
+        // Row level writes, the JSON store still rewrites the shard
+        void savePurchases(const QList<Purchase*>& inChanged);
+        void deletePurchases(const QList<std::uint32_t>& inIds);
+        void applyPurchases(const QList<Purchase*>& inAdded, const QList<std::uint32_t>& inRemovedIds);
 
-        void deletePurchaseFromFile(std::uint32_t inId);
         void deletePurchaseFromMemory(std::uint32_t inId);
 
+        // Table and snapshot are rebuilt on their next use
+        void invalidatePurchases();
+
     private:
         bool m_didFetchPurchases;
 
@@ -238,11 +311,42 @@ namespace Financy
 
         float m_limit;
         QList<Purchase*> m_purchases;
+        Search::Table m_table;
 
         QColor m_primaryColor;
         QColor m_secondaryColor;
 
-        QList<Statement*> m_history;
+        HistoryModel* m_historyModel;
+
+        // Day groups of the statement being listed
+        StatementArena m_statements;
+
+        Simulation* m_simulation;
+
+        std::shared_ptr<const Snapshot::Account> m_snapshot;
+        bool m_isSnapshotDirty;
+    };
+
+    struct AccountData
+    {
+        std::uint32_t id     = 0;
+        std::uint32_t userId = 0;
+        QList<int> sharedUserIds;
+
+        QString name;
+        std::uint32_t closingDay = MIN_STATEMENT_CLOSING_DAY;
+        Account::Type type       = Account::Type::Expense;
+        float limit              = 1.0f;
+
+        QColor primaryColor;
+        QColor secondaryColor;
+
+        std::vector<PurchaseData> purchases;
+
+        // Approximate bytes held, purchases included
+        std::size_t getSize() const;
+
+        bool operator==(const AccountData& inOther) const;
     };
 
     static std::unordered_map<std::string, Account::Type> ACCOUNT_TYPES = {
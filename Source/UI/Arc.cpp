@@ -0,0 +1,353 @@
+#include "Arc.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QPainter>
+
+namespace Financy
+{
+    // Degrees per ring or pie segment, and segments per round cap
+    static constexpr float ANGLE_STEP        = 4.0f;
+    static constexpr std::uint32_t CAP_STEPS = 12;
+
+    // Width of the antialiasing fringe
+    static constexpr float FRINGE = 1.0f;
+
+    Arc::Arc(QQuickItem* parent)
+        : QQuickItem(parent),
+        m_arcBegin(0.0f),
+        m_arcEnd(270.0f),
+        m_arcOffset(0.0f),
+        m_isPie(false),
+        m_showBackground(false),
+        m_lineWidth(20.0f),
+        m_colorCircle("#FFFFFF"),
+        m_colorBackground("#000000")
+    {
+        setFlag(QQuickItem::ItemHasContents, true);
+
+        // Animated properties only rebuild the vertices, nodes and materials are reused
+        QObject::connect(
+            this,
+            &Arc::onEdit,
+            this,
+            &QQuickItem::update
+        );
+    }
+
+    QSGNode* Arc::updatePaintNode(QSGNode* inNode, UpdatePaintNodeData* inData)
+    {
+        Q_UNUSED(inData);
+
+        if (width() <= 0 || height() <= 0)
+        {
+            delete inNode;
+
+            return nullptr;
+        }
+
+        bool isSoftware = window()->rendererInterface()->graphicsApi() == QSGRendererInterface::Software;
+
+        return isSoftware ? updateImageNode(inNode) : updateGeometryNode(inNode);
+    }
+
+    QSGNode* Arc::updateGeometryNode(QSGNode* inNode)
+    {
+        QSGNode* node = inNode;
+
+        // Background first so the arc is drawn over it
+        if (node == nullptr)
+        {
+            node = new QSGNode();
+
+            for (std::uint32_t index = 0; index < 2; index++)
+            {
+                QSGGeometry* geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+                geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+
+                QSGGeometryNode* child = new QSGGeometryNode();
+                child->setGeometry(geometry);
+                child->setMaterial(new QSGVertexColorMaterial());
+                child->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+
+                node->appendChildNode(child);
+            }
+        }
+
+        float radius = std::min(width(), height()) / 2.0f;
+        float begin  = std::clamp(m_arcBegin, 0.0f, 360.0f);
+        float end    = std::clamp(m_arcEnd,   0.0f, 360.0f);
+
+        std::vector<Vertex> background {};
+        std::vector<Vertex> arc        {};
+
+        if (m_isPie)
+        {
+            if (m_showBackground)
+            {
+                buildPie(background, 0.0f, 360.0f, radius);
+            }
+
+            buildPie(arc, begin, end, radius);
+        }
+        else
+        {
+            if (m_showBackground)
+            {
+                buildRing(background, 0.0f, 360.0f, radius - (m_lineWidth / 2.0f), m_lineWidth * 0.6f, false);
+            }
+
+            buildRing(arc, begin, end, radius - (m_lineWidth / 2.0f), m_lineWidth, true);
+        }
+
+        setGeometry(static_cast<QSGGeometryNode*>(node->firstChild()), background, m_colorBackground);
+        setGeometry(static_cast<QSGGeometryNode*>(node->lastChild()),  arc,        m_colorCircle);
+
+        return node;
+    }
+
+    QSGNode* Arc::updateImageNode(QSGNode* inNode)
+    {
+        QSGImageNode* node = static_cast<QSGImageNode*>(inNode);
+
+        if (node == nullptr)
+        {
+            node = window()->createImageNode();
+            node->setOwnsTexture(true);
+            node->setFiltering(QSGTexture::Linear);
+        }
+
+        qreal ratio = window()->effectiveDevicePixelRatio();
+
+        QImage image(
+            QSize(
+                std::ceil(width()  * ratio),
+                std::ceil(height() * ratio)
+            ),
+            QImage::Format_ARGB32_Premultiplied
+        );
+        image.setDevicePixelRatio(ratio);
+        image.fill(Qt::transparent);
+
+        float begin = std::clamp(m_arcBegin, 0.0f, 360.0f);
+        float end   = std::clamp(m_arcEnd,   0.0f, 360.0f);
+
+        // QPainter angles are counter clockwise from three o'clock, in sixteenths of a degree
+        int start = std::round((90.0f - (begin + m_arcOffset)) * 16.0f);
+        int span  = std::round(-(end - begin) * 16.0f);
+
+        QPainter painter(&image);
+        painter.setRenderHint(QPainter::Antialiasing);
+
+        if (m_isPie)
+        {
+            QRectF rect(0.0, 0.0, width(), height());
+
+            painter.setPen(Qt::NoPen);
+
+            if (m_showBackground)
+            {
+                painter.setBrush(m_colorBackground);
+                painter.drawEllipse(rect);
+            }
+
+            if (span != 0)
+            {
+                painter.setBrush(m_colorCircle);
+                painter.drawPie(rect, start, span);
+            }
+        }
+        else
+        {
+            QRectF rect(
+                m_lineWidth / 2.0f,
+                m_lineWidth / 2.0f,
+                width()  - m_lineWidth,
+                height() - m_lineWidth
+            );
+
+            painter.setBrush(Qt::NoBrush);
+
+            if (m_showBackground)
+            {
+                painter.setPen(QPen(m_colorBackground, m_lineWidth * 0.6f));
+                painter.drawEllipse(rect);
+            }
+
+            if (span != 0)
+            {
+                painter.setPen(QPen(m_colorCircle, m_lineWidth, Qt::SolidLine, Qt::RoundCap));
+                painter.drawArc(rect, start, span);
+            }
+        }
+
+        painter.end();
+
+        node->setTexture(window()->createTextureFromImage(image));
+        node->setRect(boundingRect());
+
+        return node;
+    }
+
+    void Arc::buildRing(std::vector<Vertex>& outVertices, float inBegin, float inEnd, float inRadius, float inWidth, bool inHasCaps)
+    {
+        if (inEnd <= inBegin || inWidth <= 0.0f)
+        {
+            return;
+        }
+
+        float inner = inRadius - (inWidth / 2.0f);
+        float outer = inRadius + (inWidth / 2.0f);
+
+        std::uint32_t steps = std::max(1.0f, std::ceil((inEnd - inBegin) / ANGLE_STEP));
+
+        for (std::uint32_t step = 0; step < steps; step++)
+        {
+            float from = inBegin + ((inEnd - inBegin) * step)       / steps;
+            float to   = inBegin + ((inEnd - inBegin) * (step + 1)) / steps;
+
+            QPointF innerFrom = getPoint(from, inner);
+            QPointF outerFrom = getPoint(from, outer);
+            QPointF innerTo   = getPoint(to,   inner);
+            QPointF outerTo   = getPoint(to,   outer);
+
+            outVertices.insert(outVertices.end(), { { outerFrom, 1.0f }, { innerFrom, 1.0f }, { outerTo, 1.0f } });
+            outVertices.insert(outVertices.end(), { { outerTo,   1.0f }, { innerFrom, 1.0f }, { innerTo, 1.0f } });
+
+            addFringe(outVertices, outerFrom, getPoint(from, outer + FRINGE), outerTo, getPoint(to, outer + FRINGE));
+            addFringe(
+                outVertices,
+                innerFrom,
+                getPoint(from, std::max(0.0f, inner - FRINGE)),
+                innerTo,
+                getPoint(to,   std::max(0.0f, inner - FRINGE))
+            );
+        }
+
+        if (!inHasCaps)
+        {
+            return;
+        }
+
+        // Half discs past each end, from the outer edge around to the inner one
+        for (float angle : { inBegin, inEnd })
+        {
+            float radians   = qDegreesToRadians(angle + m_arcOffset);
+            float direction = angle == inBegin ? -1.0f : 1.0f;
+
+            QPointF center  = getPoint(angle, inRadius);
+            QPointF radial  = QPointF(std::sin(radians), -std::cos(radians)) * (inWidth / 2.0f);
+            QPointF tangent = QPointF(std::cos(radians),  std::sin(radians)) * (inWidth / 2.0f) * direction;
+
+            // Scales a point on the cap onto its fringe
+            float fringe = ((inWidth / 2.0f) + FRINGE) / (inWidth / 2.0f);
+
+            QPointF previous = center + radial;
+
+            for (std::uint32_t step = 1; step <= CAP_STEPS; step++)
+            {
+                float sweep = qDegreesToRadians((180.0f * step) / CAP_STEPS);
+
+                QPointF current = center + (radial * std::cos(sweep)) + (tangent * std::sin(sweep));
+
+                outVertices.insert(outVertices.end(), { { center, 1.0f }, { previous, 1.0f }, { current, 1.0f } });
+
+                addFringe(
+                    outVertices,
+                    previous,
+                    center + ((previous - center) * fringe),
+                    current,
+                    center + ((current - center) * fringe)
+                );
+
+                previous = current;
+            }
+        }
+    }
+
+    void Arc::buildPie(std::vector<Vertex>& outVertices, float inBegin, float inEnd, float inRadius)
+    {
+        if (inEnd <= inBegin)
+        {
+            return;
+        }
+
+        QPointF center = getPoint(0.0f, 0.0f);
+
+        std::uint32_t steps = std::max(1.0f, std::ceil((inEnd - inBegin) / ANGLE_STEP));
+
+        for (std::uint32_t step = 0; step < steps; step++)
+        {
+            float from = inBegin + ((inEnd - inBegin) * step)       / steps;
+            float to   = inBegin + ((inEnd - inBegin) * (step + 1)) / steps;
+
+            QPointF edgeFrom = getPoint(from, inRadius);
+            QPointF edgeTo   = getPoint(to,   inRadius);
+
+            outVertices.insert(outVertices.end(), { { center, 1.0f }, { edgeFrom, 1.0f }, { edgeTo, 1.0f } });
+
+            addFringe(outVertices, edgeFrom, getPoint(from, inRadius + FRINGE), edgeTo, getPoint(to, inRadius + FRINGE));
+        }
+
+        if (inEnd - inBegin >= 360.0f)
+        {
+            return;
+        }
+
+        // Straight sides of a slice fade out away from the slice, along the tangent at each end
+        for (float angle : { inBegin, inEnd })
+        {
+            float radians   = qDegreesToRadians(angle + m_arcOffset);
+            float direction = angle == inBegin ? -1.0f : 1.0f;
+
+            QPointF edge    = getPoint(angle, inRadius);
+            QPointF tangent = QPointF(std::cos(radians), std::sin(radians)) * FRINGE * direction;
+
+            addFringe(outVertices, center, center + tangent, edge, edge + tangent);
+        }
+    }
+
+    void Arc::addFringe(std::vector<Vertex>& outVertices, QPointF inFrom, QPointF inFromFringe, QPointF inTo, QPointF inToFringe)
+    {
+        outVertices.insert(outVertices.end(), { { inFrom, 1.0f }, { inFromFringe, 0.0f }, { inTo,       1.0f } });
+        outVertices.insert(outVertices.end(), { { inTo,   1.0f }, { inFromFringe, 0.0f }, { inToFringe, 0.0f } });
+    }
+
+    void Arc::setGeometry(QSGGeometryNode* ioNode, const std::vector<Vertex>& inVertices, const QColor& inColor)
+    {
+        QSGGeometry* geometry = ioNode->geometry();
+        geometry->allocate(inVertices.size());
+
+        QSGGeometry::ColoredPoint2D* vertices = geometry->vertexDataAsColoredPoint2D();
+
+        for (std::size_t index = 0; index < inVertices.size(); index++)
+        {
+            const Vertex& vertex = inVertices[index];
+
+            // The vertex color material takes premultiplied colors
+            float alpha = inColor.alphaF() * vertex.alpha;
+
+            vertices[index].set(
+                vertex.point.x(),
+                vertex.point.y(),
+                std::round(inColor.red()   * alpha),
+                std::round(inColor.green() * alpha),
+                std::round(inColor.blue()  * alpha),
+                std::round(255.0f          * alpha)
+            );
+        }
+
+        ioNode->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    QPointF Arc::getPoint(float inAngle, float inRadius)
+    {
+        float radians = qDegreesToRadians(inAngle + m_arcOffset);
+
+        return QPointF(
+            (width()  / 2.0) + (inRadius * std::sin(radians)),
+            (height() / 2.0) - (inRadius * std::cos(radians))
+        );
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <vector>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+#include <QtQuick>
+#include <QColor>
+
+namespace Financy
+{
+    // Ring or pie arc drawn as scene graph geometry, angles are in degrees, clockwise from the top.
+    // The software renderer has no custom geometry, there the arc is painted into a texture
+    class Arc : public QQuickItem
+    {
+        Q_OBJECT
+        QML_ELEMENT
+
+        Q_PROPERTY(
+            float arcBegin
+            MEMBER m_arcBegin
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            float arcEnd
+            MEMBER m_arcEnd
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            float arcOffset
+            MEMBER m_arcOffset
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            bool isPie
+            MEMBER m_isPie
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            bool showBackground
+            MEMBER m_showBackground
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            float lineWidth
+            MEMBER m_lineWidth
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            QColor colorCircle
+            MEMBER m_colorCircle
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            QColor colorBackground
+            MEMBER m_colorBackground
+            NOTIFY onEdit
+        )
+
+    public:
+        Arc(QQuickItem* parent = nullptr);
+        ~Arc() = default;
+
+    signals:
+        void onEdit();
+
+    protected:
+        QSGNode* updatePaintNode(QSGNode* inNode, UpdatePaintNodeData* inData) override;
+
+    private:
+        struct Vertex
+        {
+            QPointF point;
+            float alpha;
+        };
+
+    private:
+        QSGNode* updateGeometryNode(QSGNode* inNode);
+        QSGNode* updateImageNode(QSGNode* inNode);
+
+        // Triangles of a ring section with optional round caps, or of a pie slice, edges fade out
+        // over a pixel wide fringe since the scene graph draws them without antialiasing
+        void buildRing(std::vector<Vertex>& outVertices, float inBegin, float inEnd, float inRadius, float inWidth, bool inHasCaps);
+        void buildPie(std::vector<Vertex>& outVertices, float inBegin, float inEnd, float inRadius);
+
+        // Edge from inFrom to inTo, fading out towards inFromFringe and inToFringe
+        void addFringe(std::vector<Vertex>& outVertices, QPointF inFrom, QPointF inFromFringe, QPointF inTo, QPointF inToFringe);
+
+        void setGeometry(QSGGeometryNode* ioNode, const std::vector<Vertex>& inVertices, const QColor& inColor);
+
+        QPointF getPoint(float inAngle, float inRadius);
+
+    private:
+        float m_arcBegin;
+        float m_arcEnd;
+        float m_arcOffset;
+
+        bool m_isPie;
+        bool m_showBackground;
+
+        float m_lineWidth;
+
+        QColor m_colorCircle;
+        QColor m_colorBackground;
+    };
+}
@@ -0,0 +1,220 @@
+#include "AvatarProvider.hpp"
+
+#include <algorithm>
+
+#include <QBuffer>
+#include <QImageReader>
+
+#include "Core/FileSystem.hpp"
+#include "Storage/PictureStore.hpp"
+
+namespace Financy
+{
+    struct AvatarKey
+    {
+        std::uint32_t userId = 0;
+        std::uint32_t size   = 0;
+
+        bool operator==(const AvatarKey& inOther) const
+        {
+            return userId == inOther.userId && size == inOther.size;
+        }
+    };
+
+    struct AvatarKeyHash
+    {
+        std::size_t operator()(const AvatarKey& inKey) const
+        {
+            return (((std::size_t) inKey.userId) << 32) ^ inKey.size;
+        }
+    };
+
+    struct AvatarEntry
+    {
+        QImage image;
+        std::list<AvatarKey>::iterator position;
+    };
+
+    QMutex avatarMutex;
+
+    std::unordered_map<std::uint32_t, QString> avatarPictures {};
+
+    // Front is the most recently used
+    std::list<AvatarKey> avatarOrder {};
+    std::unordered_map<AvatarKey, AvatarEntry, AvatarKeyHash> avatarCache {};
+
+    void AvatarProvider::setPicture(std::uint32_t inUserId, const QString& inHash)
+    {
+        {
+            QMutexLocker locker(&avatarMutex);
+
+            auto iterator = avatarPictures.find(inUserId);
+
+            if (iterator != avatarPictures.end() && iterator->second == inHash)
+            {
+                return;
+            }
+
+            avatarPictures[inUserId] = inHash;
+        }
+
+        invalidate(inUserId);
+    }
+
+    void AvatarProvider::invalidate(std::uint32_t inUserId)
+    {
+        QMutexLocker locker(&avatarMutex);
+
+        for (auto iterator = avatarOrder.begin(); iterator != avatarOrder.end();)
+        {
+            if (iterator->userId != inUserId)
+            {
+                iterator++;
+
+                continue;
+            }
+
+            avatarCache.erase(*iterator);
+
+            iterator = avatarOrder.erase(iterator);
+        }
+    }
+
+    QString AvatarProvider::getUrl(std::uint32_t inUserId, std::uint32_t inSize, std::uint32_t inRevision)
+    {
+        // The revision only busts the QML pixmap cache, the provider ignores it
+        return QString("image://%1/%2/%3?v=%4")
+            .arg(PROVIDER_NAME)
+            .arg(inUserId)
+            .arg(inSize)
+            .arg(inRevision);
+    }
+
+    AvatarProvider::AvatarProvider()
+        : QQuickImageProvider(QQuickImageProvider::Image)
+    {}
+
+    QImage AvatarProvider::requestImage(const QString& inId, QSize* outSize, const QSize& inRequestedSize)
+    {
+        QStringList path = inId.section('?', 0, 0).split('/');
+
+        if (path.size() < 1)
+        {
+            return QImage();
+        }
+
+        AvatarKey key;
+        key.userId = path[0].toUInt();
+        key.size   = path.size() > 1 ? path[1].toUInt() : Storage::Pictures::THUMBNAIL_SIZE;
+
+        if (inRequestedSize.isValid())
+        {
+            key.size = std::max(inRequestedSize.width(), inRequestedSize.height());
+        }
+
+        key.size = std::clamp(key.size, (std::uint32_t) 1, Storage::Pictures::THUMBNAIL_SIZE * 4);
+
+        QString hash;
+
+        {
+            QMutexLocker locker(&avatarMutex);
+
+            auto cached = avatarCache.find(key);
+
+            if (cached != avatarCache.end())
+            {
+                avatarOrder.splice(avatarOrder.begin(), avatarOrder, cached->second.position);
+
+                if (outSize)
+                {
+                    *outSize = cached->second.image.size();
+                }
+
+                return cached->second.image;
+            }
+
+            auto picture = avatarPictures.find(key.userId);
+
+            if (picture == avatarPictures.end())
+            {
+                return QImage();
+            }
+
+            hash = picture->second;
+        }
+
+        // Decode outside of the lock, a duplicated decode on a race is harmless
+        QImage image = load(hash, key.size);
+
+        if (outSize)
+        {
+            *outSize = image.size();
+        }
+
+        if (image.isNull())
+        {
+            return image;
+        }
+
+        QMutexLocker locker(&avatarMutex);
+
+        if (avatarCache.find(key) != avatarCache.end())
+        {
+            return image;
+        }
+
+        avatarOrder.push_front(key);
+        avatarCache[key] = { image, avatarOrder.begin() };
+
+        while (avatarOrder.size() > CACHE_SIZE)
+        {
+            avatarCache.erase(avatarOrder.back());
+            avatarOrder.pop_back();
+        }
+
+        return image;
+    }
+
+    QImage AvatarProvider::load(const QString& inHash, std::uint32_t inSize)
+    {
+        if (!Storage::Pictures::has(inHash))
+        {
+            return QImage();
+        }
+
+        // The thumbnail covers the usual avatar sizes, only bigger requests go to the original
+        std::string path = inSize <= Storage::Pictures::THUMBNAIL_SIZE ?
+            Storage::Pictures::getThumbnailPath(inHash) :
+            Storage::Pictures::getPicturePath(inHash);
+
+        FileSystem::MappedFile file(path);
+
+        if (!file.isOpen())
+        {
+            return QImage();
+        }
+
+        QByteArray data = QByteArray::fromRawData(file.getData(), file.getSize());
+
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::ReadOnly);
+
+        QImageReader reader(&buffer);
+        reader.setAutoTransform(true);
+
+        QSize size = reader.size();
+
+        if (size.isValid())
+        {
+            reader.setScaledSize(
+                size.scaled(
+                    inSize,
+                    inSize,
+                    Qt::KeepAspectRatioByExpanding
+                )
+            );
+        }
+
+        return reader.read();
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <list>
+#include <unordered_map>
+
+#include <QtCore>
+#include <QImage>
+#include <QQuickImageProvider>
+
+namespace Financy
+{
+    // Serves image://avatar/<userId>/<size> from an LRU of decoded, pre-scaled pictures
+    class AvatarProvider : public QQuickImageProvider
+    {
+    public:
+        static constexpr auto PROVIDER_NAME       = "avatar";
+        static constexpr std::uint32_t CACHE_SIZE = 64;
+
+    public:
+        static void setPicture(std::uint32_t inUserId, const QString& inHash);
+        static void invalidate(std::uint32_t inUserId);
+
+        static QString getUrl(std::uint32_t inUserId, std::uint32_t inSize, std::uint32_t inRevision);
+
+    public:
+        AvatarProvider();
+        ~AvatarProvider() = default;
+
+    public:
+        QImage requestImage(const QString& inId, QSize* outSize, const QSize& inRequestedSize) override;
+
+    private:
+        static QImage load(const QString& inHash, std::uint32_t inSize);
+    };
+}
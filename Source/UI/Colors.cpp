@@ -10,15 +10,7 @@ namespace Financy
         m_foreground("#000000"),
         m_light("#FFFFFF"),
         m_dark("#000000")
-    {
-        qmlRegisterUncreatableType<Colors>(
-            "Financy.Types",
-            1,
-            0,
-            "Colors",
-            "Internal use only"
-        );
-    }
+    {}
 
     void Colors::setBackgroundColor(const QColor& inColor)
     {
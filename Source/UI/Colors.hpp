@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 #include <QObject>
 #include <QImage>
 
@@ -9,6 +10,8 @@ namespace Financy
     class Colors : public QObject
     {
         Q_OBJECT
+        QML_ELEMENT
+        QML_UNCREATABLE("Internal use only")
 
         // Properties
         Q_PROPERTY(
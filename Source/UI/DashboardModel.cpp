@@ -0,0 +1,176 @@
+#include "DashboardModel.hpp"
+
+#include <algorithm>
+
+#include "Search/Query.hpp"
+#include "UI/Internal.hpp"
+
+namespace Financy
+{
+    DashboardModel::DashboardModel(Internal* parent)
+        : QObject(parent),
+        m_internal(parent),
+        m_users({}),
+        m_userFilter(-1),
+        m_totals({}),
+        m_cache({}),
+        m_cacheVersion(0),
+        m_cacheViewerId(-1)
+    {}
+
+    void DashboardModel::refresh(int inUserId)
+    {
+        User* user = Internal::getSelectedUser();
+
+        if (user == nullptr)
+        {
+            clear();
+
+            return;
+        }
+
+        Context context             = Internal::getContext();
+        Snapshot::ModelPtr snapshot = Internal::getSnapshot();
+
+        // Any edit publishes a new version, whatever was cached before it is stale
+        if (snapshot->version != m_cacheVersion || context.viewerId != m_cacheViewerId)
+        {
+            m_cache.clear();
+
+            m_cacheVersion  = snapshot->version;
+            m_cacheViewerId = context.viewerId;
+        }
+
+        std::pair<int, qint64> key = { inUserId, context.asOf.toJulianDay() };
+
+        auto iterator = m_cache.find(key);
+
+        if (iterator == m_cache.end())
+        {
+            iterator = m_cache.emplace(key, compute(user, context, inUserId)).first;
+        }
+
+        m_users      = getUsers(user);
+        m_userFilter = inUserId;
+        m_totals     = iterator->second;
+
+        emit onRefresh();
+    }
+
+    void DashboardModel::clear()
+    {
+        m_users.clear();
+        m_userFilter = -1;
+        m_totals     = {};
+        m_cache.clear();
+
+        emit onRefresh();
+    }
+
+    QVariantMap DashboardModel::getExpenseMap() const
+    {
+        return m_totals.expenseMap;
+    }
+
+    float DashboardModel::getDueAmount() const
+    {
+        return m_totals.dueAmount;
+    }
+
+    float DashboardModel::getSavedAmount() const
+    {
+        return m_totals.savedAmount;
+    }
+
+    DashboardModel::Totals DashboardModel::compute(User* inUser, const Context& inContext, int inUserId)
+    {
+        Search::Query query;
+        query.statementDate = inContext.asOf;
+        query.userId        = inUserId;
+
+        QMap<QString, float> map;
+        float due = 0.0f;
+
+        // Same purchases User::getExpenseMap and User::getDueAmount walk, once for both
+        inUser->forEachPurchase(
+            inContext,
+            query,
+            [&map, &due](Purchase* inPurchase)
+            {
+                float value = inPurchase->getInstallmentValue();
+
+                map[inPurchase->getTypeName()] += value;
+                due                            += value;
+            }
+        );
+
+        Totals result;
+        result.dueAmount   = due;
+        result.savedAmount = inUser->getIncome() - due;
+
+        for (QMap<QString, float>::iterator iterator = map.begin(); iterator != map.end(); iterator++)
+        {
+            result.expenseMap.insert(
+                iterator.key(),
+                iterator.value()
+            );
+        }
+
+        return result;
+    }
+
+    QList<User*> DashboardModel::getUsers(User* inUser)
+    {
+        QList<int> userIds {};
+
+        for (Account* account : inUser->getAccounts())
+        {
+            if (!account->isOwnedBy(inUser->getId()))
+            {
+                continue;
+            }
+
+            for (int sharedUserId : account->getSharedUserIds())
+            {
+                if (sharedUserId == (int) inUser->getId() || userIds.contains(sharedUserId))
+                {
+                    continue;
+                }
+
+                userIds.push_back(sharedUserId);
+            }
+        }
+
+        QList<User*> result {};
+
+        for (int userId : userIds)
+        {
+            User* user = m_internal->getUser(userId);
+
+            if (user == nullptr)
+            {
+                continue;
+            }
+
+            result.push_back(user);
+        }
+
+        // Without anyone to filter by there is only "All"
+        if (result.isEmpty())
+        {
+            return { inUser };
+        }
+
+        result.push_back(inUser);
+
+        std::sort(
+            result.begin(),
+            result.end(),
+            [](User* a, User* b) { return a->getId() < b->getId(); }
+        );
+
+        result.push_front(inUser);
+
+        return result;
+    }
+}
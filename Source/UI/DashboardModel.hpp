@@ -0,0 +1,92 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+
+#include "Core/Context.hpp"
+
+namespace Financy
+{
+    class Internal;
+    class User;
+
+    // Everything the user home shows for one filter and date, computed in a single pass over the
+    // expense accounts and kept until the data model or the viewer changes
+    class DashboardModel : public QObject
+    {
+        Q_OBJECT
+        QML_ANONYMOUS
+
+        Q_PROPERTY(
+            QList<User*> users
+            MEMBER m_users
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            int userFilter
+            MEMBER m_userFilter
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            QVariantMap expenseMap
+            READ getExpenseMap
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            float dueAmount
+            READ getDueAmount
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            float savedAmount
+            READ getSavedAmount
+            NOTIFY onRefresh
+        )
+
+    public:
+        struct Totals
+        {
+            QVariantMap expenseMap;
+
+            float dueAmount   = 0.0f;
+            float savedAmount = 0.0f;
+        };
+
+    public:
+        DashboardModel(Internal* parent);
+        ~DashboardModel() = default;
+
+    signals:
+        void onRefresh();
+
+    public slots:
+        // inUserId filters the buyer, -1 for everyone
+        void refresh(int inUserId = -1);
+        void clear();
+
+        QVariantMap getExpenseMap() const;
+        float getDueAmount() const;
+        float getSavedAmount() const;
+
+    private:
+        Totals compute(User* inUser, const Context& inContext, int inUserId);
+
+        // "All" first, then the user and whoever shares the user's accounts, by id
+        QList<User*> getUsers(User* inUser);
+
+    private:
+        Internal* m_internal;
+
+        QList<User*> m_users;
+        int m_userFilter;
+        Totals m_totals;
+
+        // (filter, julian day of the date) -> totals, valid for one snapshot version and viewer
+        std::map<std::pair<int, qint64>, Totals> m_cache;
+        std::uint64_t m_cacheVersion;
+        int m_cacheViewerId;
+    };
+}
@@ -0,0 +1,149 @@
+#include "ForecastModel.hpp"
+
+#include "UI/Internal.hpp"
+
+namespace Financy
+{
+    ForecastModel::ForecastModel(QObject* parent)
+        : QAbstractListModel(parent),
+        m_months({}),
+        m_generation(0)
+    {}
+
+    void ForecastModel::refresh(int inUserId, int inMonths)
+    {
+        std::uint32_t generation = ++m_generation;
+
+        // The snapshot is pinned here, edits made while the worker runs wait for the next refresh
+        Snapshot::ModelPtr model = Internal::getSnapshot();
+        Context context          = Internal::getContext();
+        std::uint32_t count      = std::max(inMonths, 0);
+
+        QThreadPool::globalInstance()->start(
+            [this, generation, model, context, inUserId, count]()
+            {
+                std::vector<Forecast::Month> months = Forecast::compute(model, context, inUserId, count);
+
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, generation, months]()
+                    {
+                        if (generation != m_generation)
+                        {
+                            return;
+                        }
+
+                        setMonths(months);
+                    },
+                    Qt::QueuedConnection
+                );
+            }
+        );
+    }
+
+    void ForecastModel::clear()
+    {
+        m_generation++;
+
+        setMonths({});
+    }
+
+    QVariantMap ForecastModel::get(int inRow) const
+    {
+        QVariantMap result {};
+
+        if (inRow < 0 || inRow >= (int) m_months.size())
+        {
+            return result;
+        }
+
+        QModelIndex index                  = this->index(inRow);
+        const QHash<int, QByteArray> names = roleNames();
+
+        for (auto iterator = names.cbegin(); iterator != names.cend(); iterator++)
+        {
+            result[QString::fromLatin1(iterator.value())] = data(index, iterator.key());
+        }
+
+        return result;
+    }
+
+    float ForecastModel::getMaxDue() const
+    {
+        float result = 0.0f;
+
+        for (const Forecast::Month& month : m_months)
+        {
+            result = std::max(result, month.due);
+        }
+
+        return result;
+    }
+
+    int ForecastModel::rowCount(const QModelIndex& inParent) const
+    {
+        if (inParent.isValid())
+        {
+            return 0;
+        }
+
+        return m_months.size();
+    }
+
+    QVariant ForecastModel::data(const QModelIndex& inIndex, int inRole) const
+    {
+        if (!inIndex.isValid() || inIndex.row() < 0 || inIndex.row() >= (int) m_months.size())
+        {
+            return QVariant();
+        }
+
+        const Forecast::Month& month = m_months[inIndex.row()];
+
+        switch (inRole)
+        {
+        case DateRole:
+            return month.date;
+
+        case InstallmentsRole:
+            return month.installments;
+
+        case RecurringRole:
+            return month.recurring;
+
+        case DueRole:
+            return month.due;
+
+        case IncomeRole:
+            return month.income;
+
+        case SavedRole:
+            return month.saved;
+
+        default:
+            return QVariant();
+        }
+    }
+
+    void ForecastModel::setMonths(const std::vector<Forecast::Month>& inMonths)
+    {
+        beginResetModel();
+
+        m_months = inMonths;
+
+        endResetModel();
+
+        emit onRefresh();
+    }
+
+    QHash<int, QByteArray> ForecastModel::roleNames() const
+    {
+        return {
+            { DateRole,         "date" },
+            { InstallmentsRole, "installments" },
+            { RecurringRole,    "recurring" },
+            { DueRole,          "due" },
+            { IncomeRole,       "income" },
+            { SavedRole,        "saved" }
+        };
+    }
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+#include <QAbstractListModel>
+
+#include "Core/Forecast.hpp"
+
+namespace Financy
+{
+    // One row per future statement, feeds the cash flow chart
+    class ForecastModel : public QAbstractListModel
+    {
+        Q_OBJECT
+        QML_ANONYMOUS
+
+        Q_PROPERTY(
+            int count
+            READ rowCount
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            float maxDue
+            READ getMaxDue
+            NOTIFY onRefresh
+        )
+
+    public:
+        enum Role
+        {
+            DateRole = Qt::UserRole + 1,
+            InstallmentsRole,
+            RecurringRole,
+            DueRole,
+            IncomeRole,
+            SavedRole
+        };
+
+    public:
+        ForecastModel(QObject* parent = nullptr);
+        ~ForecastModel() = default;
+
+    signals:
+        void onRefresh();
+
+    public slots:
+        // inUserId filters the buyer like the rest of the dashboard, -1 for everyone. Computed on the
+        // thread pool, onRefresh fires once the rows are in
+        void refresh(int inUserId = -1, int inMonths = 12);
+        void clear();
+
+        // Row as a plain map, what the chart reads
+        QVariantMap get(int inRow) const;
+
+        float getMaxDue() const;
+
+    public:
+        int rowCount(const QModelIndex& inParent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& inIndex, int inRole = Qt::DisplayRole) const override;
+        QHash<int, QByteArray> roleNames() const override;
+
+    private:
+        void setMonths(const std::vector<Forecast::Month>& inMonths);
+
+    private:
+        std::vector<Forecast::Month> m_months;
+
+        // Bumped by every refresh and clear, results of older requests are dropped
+        std::uint32_t m_generation;
+    };
+}
@@ -0,0 +1,306 @@
+#include "HistoryModel.hpp"
+
+#include <algorithm>
+
+#include "Base.hpp"
+#include "UI/Account.hpp"
+
+namespace Financy
+{
+    HistoryModel::HistoryModel(QObject* parent)
+        : QAbstractListModel(parent),
+        m_rollup(MIN_STATEMENT_CLOSING_DAY),
+        m_closingDay(MIN_STATEMENT_CLOSING_DAY),
+        m_firstIndex(0),
+        m_lastIndex(-1),
+        m_currentIndex(0),
+        m_beginIndex(0),
+        m_totals({}),
+        m_maxDue(0.0f)
+    {}
+
+    void HistoryModel::refresh(Account* inAccount, const Context& inContext, int inUserId)
+    {
+        beginResetModel();
+
+        m_rollup       = inAccount->getRollup(inContext, inUserId);
+        m_closingDay   = inAccount->getClosingDay();
+        m_currentIndex = Search::Rollup::getStatementIndex(inContext.asOf, m_closingDay);
+        m_firstIndex   = m_rollup.getFirstIndex();
+        m_lastIndex    = std::max(m_rollup.getLastIndex(), m_currentIndex);
+        m_maxDue       = 0.0f;
+        m_totals.clear();
+
+        // Same trimming as the full history had: leading empty statements, and a trailing one
+        // holding nothing but recurring values
+        while (m_firstIndex <= m_lastIndex)
+        {
+            Search::Rollup::Totals totals = m_rollup.get(m_firstIndex);
+
+            if (totals.installments != 0.0f || totals.recurring != 0.0f)
+            {
+                break;
+            }
+
+            m_firstIndex++;
+        }
+
+        if (m_firstIndex <= m_lastIndex && m_rollup.get(m_lastIndex).installments == 0.0f)
+        {
+            m_lastIndex--;
+        }
+
+        if (m_firstIndex <= m_lastIndex)
+        {
+            for (const Search::Rollup::Totals& totals : m_rollup.get(m_firstIndex, m_lastIndex - m_firstIndex + 1))
+            {
+                m_maxDue = std::max(m_maxDue, totals.installments + totals.recurring);
+            }
+
+            int current = std::clamp(m_currentIndex, m_firstIndex, m_lastIndex);
+
+            m_beginIndex = std::max(m_firstIndex, current - PAGE_SIZE);
+
+            int endIndex = std::min(m_lastIndex, current + PAGE_SIZE);
+
+            for (const Search::Rollup::Totals& totals : m_rollup.get(m_beginIndex, endIndex - m_beginIndex + 1))
+            {
+                m_totals.push_back(totals);
+            }
+        }
+
+        endResetModel();
+
+        emit onRefresh();
+    }
+
+    void HistoryModel::clear()
+    {
+        beginResetModel();
+
+        m_firstIndex = 0;
+        m_lastIndex  = -1;
+        m_beginIndex = 0;
+        m_maxDue     = 0.0f;
+        m_totals.clear();
+
+        endResetModel();
+
+        emit onRefresh();
+    }
+
+    QVariantMap HistoryModel::get(int inRow) const
+    {
+        QVariantMap result {};
+
+        if (inRow < 0 || inRow >= (int) m_totals.size())
+        {
+            return result;
+        }
+
+        QModelIndex index                  = this->index(inRow);
+        const QHash<int, QByteArray> names = roleNames();
+
+        for (auto iterator = names.cbegin(); iterator != names.cend(); iterator++)
+        {
+            result[QString::fromLatin1(iterator.value())] = data(index, iterator.key());
+        }
+
+        return result;
+    }
+
+    bool HistoryModel::hasPrevious() const
+    {
+        return !m_totals.empty() && m_beginIndex > m_firstIndex;
+    }
+
+    bool HistoryModel::hasNext() const
+    {
+        return !m_totals.empty() && m_beginIndex + (int) m_totals.size() - 1 < m_lastIndex;
+    }
+
+    int HistoryModel::fetchPrevious()
+    {
+        if (!hasPrevious())
+        {
+            return 0;
+        }
+
+        int count = std::min(PAGE_SIZE, m_beginIndex - m_firstIndex);
+
+        beginInsertRows(QModelIndex(), 0, count - 1);
+
+        m_beginIndex -= count;
+
+        std::vector<Search::Rollup::Totals> totals = m_rollup.get(m_beginIndex, count);
+        m_totals.insert(m_totals.begin(), totals.begin(), totals.end());
+
+        endInsertRows();
+
+        trim(false);
+
+        emit onRefresh();
+
+        return count;
+    }
+
+    int HistoryModel::fetchNext()
+    {
+        if (!hasNext())
+        {
+            return 0;
+        }
+
+        int endIndex = m_beginIndex + (int) m_totals.size();
+        int count    = std::min(PAGE_SIZE, m_lastIndex - endIndex + 1);
+
+        beginInsertRows(QModelIndex(), m_totals.size(), m_totals.size() + count - 1);
+
+        std::vector<Search::Rollup::Totals> totals = m_rollup.get(endIndex, count);
+        m_totals.insert(m_totals.end(), totals.begin(), totals.end());
+
+        endInsertRows();
+
+        int dropped = trim(true);
+
+        emit onRefresh();
+
+        return -dropped;
+    }
+
+    int HistoryModel::getCurrentRow() const
+    {
+        if (m_totals.empty())
+        {
+            return -1;
+        }
+
+        int row = m_currentIndex - m_beginIndex;
+
+        // Past every statement, like the timeline always did, the latest one is picked
+        if (row < 0 || row >= (int) m_totals.size())
+        {
+            return m_totals.size() - 1;
+        }
+
+        return row;
+    }
+
+    float HistoryModel::getMaxDue() const
+    {
+        return m_maxDue;
+    }
+
+    int HistoryModel::rowCount(const QModelIndex& inParent) const
+    {
+        if (inParent.isValid())
+        {
+            return 0;
+        }
+
+        return m_totals.size();
+    }
+
+    QVariant HistoryModel::data(const QModelIndex& inIndex, int inRole) const
+    {
+        if (!inIndex.isValid() || inIndex.row() < 0 || inIndex.row() >= (int) m_totals.size())
+        {
+            return QVariant();
+        }
+
+        const Search::Rollup::Totals& totals = m_totals[inIndex.row()];
+        int statementIndex                   = m_beginIndex + inIndex.row();
+
+        switch (inRole)
+        {
+        case DateRole:
+            return getDate(statementIndex);
+
+        case DueRole:
+            return totals.installments + totals.recurring;
+
+        case InstallmentsRole:
+            return totals.installments;
+
+        case RecurringRole:
+            return totals.recurring;
+
+        case IsCurrentRole:
+            return statementIndex == m_currentIndex;
+
+        case IsFutureRole:
+            return statementIndex > m_currentIndex;
+
+        default:
+            return QVariant();
+        }
+    }
+
+    QHash<int, QByteArray> HistoryModel::roleNames() const
+    {
+        return {
+            { DateRole,         "date" },
+            { DueRole,          "dueAmount" },
+            { InstallmentsRole, "installments" },
+            { RecurringRole,    "recurring" },
+            { IsCurrentRole,    "isCurrent" },
+            { IsFutureRole,     "isFuture" }
+        };
+    }
+
+    bool HistoryModel::canFetchMore(const QModelIndex& inParent) const
+    {
+        return !inParent.isValid() && hasNext();
+    }
+
+    void HistoryModel::fetchMore(const QModelIndex& inParent)
+    {
+        if (inParent.isValid())
+        {
+            return;
+        }
+
+        fetchNext();
+    }
+
+    QDate HistoryModel::getDate(int inStatementIndex) const
+    {
+        QDate month(inStatementIndex / 12, (inStatementIndex % 12) + 1, 1);
+
+        return QDate(
+            month.year(),
+            month.month(),
+            std::min((std::uint32_t) month.daysInMonth(), m_closingDay)
+        );
+    }
+
+    int HistoryModel::trim(bool inFromFront)
+    {
+        int count = (int) m_totals.size() - MAX_ROWS;
+
+        if (count <= 0)
+        {
+            return 0;
+        }
+
+        if (inFromFront)
+        {
+            beginRemoveRows(QModelIndex(), 0, count - 1);
+
+            m_totals.erase(m_totals.begin(), m_totals.begin() + count);
+            m_beginIndex += count;
+
+            endRemoveRows();
+
+            return count;
+        }
+
+        beginRemoveRows(QModelIndex(), m_totals.size() - count, m_totals.size() - 1);
+
+        m_totals.erase(m_totals.end() - count, m_totals.end());
+
+        endRemoveRows();
+
+        return 0;
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <deque>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+#include <QAbstractListModel>
+
+#include "Core/Context.hpp"
+#include "Search/Rollup.hpp"
+
+namespace Financy
+{
+    class Account;
+
+    // Statement timeline of one account, only a window around the current statement is materialized.
+    // It moves a page at a time in either direction and never holds more than MAX_ROWS, so scrolling
+    // costs the same however long the history is. Totals come straight from the rollup
+    class HistoryModel : public QAbstractListModel
+    {
+        Q_OBJECT
+        QML_ANONYMOUS
+
+        Q_PROPERTY(
+            int count
+            READ rowCount
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            int currentRow
+            READ getCurrentRow
+            NOTIFY onRefresh
+        )
+        Q_PROPERTY(
+            float maxDue
+            READ getMaxDue
+            NOTIFY onRefresh
+        )
+
+    public:
+        // Statements loaded on each side of the current one, and per fetch
+        static constexpr int PAGE_SIZE = 12;
+        static constexpr int MAX_ROWS  = PAGE_SIZE * 3;
+
+        enum Role
+        {
+            DateRole = Qt::UserRole + 1,
+            DueRole,
+            InstallmentsRole,
+            RecurringRole,
+            IsCurrentRole,
+            IsFutureRole
+        };
+
+    public:
+        HistoryModel(QObject* parent = nullptr);
+        ~HistoryModel() = default;
+
+    signals:
+        void onRefresh();
+
+    public slots:
+        void clear();
+
+        // Row as a plain map, what the chart and the purchase list read
+        QVariantMap get(int inRow) const;
+
+        bool hasPrevious() const;
+        bool hasNext() const;
+
+        // Returns how far the rows that were already loaded moved, rows added in front push them forward
+        // and rows dropped from the front pull them back
+        int fetchPrevious();
+        int fetchNext();
+
+        int getCurrentRow() const;
+        float getMaxDue() const;
+
+    public:
+        void refresh(Account* inAccount, const Context& inContext, int inUserId = -1);
+
+        int rowCount(const QModelIndex& inParent = QModelIndex()) const override;
+        QVariant data(const QModelIndex& inIndex, int inRole = Qt::DisplayRole) const override;
+        QHash<int, QByteArray> roleNames() const override;
+
+        bool canFetchMore(const QModelIndex& inParent) const override;
+        void fetchMore(const QModelIndex& inParent) override;
+
+    private:
+        QDate getDate(int inStatementIndex) const;
+
+        // Drops rows from the side away from the fetch until the window fits, returns how many left the front
+        int trim(bool inFromFront);
+
+    private:
+        Search::Rollup m_rollup;
+        std::uint32_t m_closingDay;
+
+        // Whole range, and the statement index of the current one
+        int m_firstIndex;
+        int m_lastIndex;
+        int m_currentIndex;
+
+        // Loaded window, row 0 is m_beginIndex
+        int m_beginIndex;
+        std::deque<Search::Rollup::Totals> m_totals;
+
+        // Over the whole range, so the chart scale doesn't move with the window
+        float m_maxDue;
+    };
+}
@@ -1,27 +1,27 @@
 #include "Internal.hpp"
 
 #include <algorithm>
+#include <unordered_set>
 #include <iostream>
 #include <fstream>
 
 #include <QtDebug>
 #include <QFileDialog>
 
-#include <opencv2/core.hpp>
-#include <opencv2/imgcodecs.hpp>
-#include <opencv2/highgui.hpp>
-
-#include <cvmatandqimage.h>
-
-#include <base64.hpp>
-
 #include "Base.hpp"
 #include "Core/FileSystem.hpp"
 #include "Core/Globals.hpp"
 #include "Core/Helper.hpp"
+#include "Core/Image.hpp"
 #include "Report/User.hpp"
+#include "Search/Fingerprint.hpp"
+#include "Storage/PurchaseShards.hpp"
 
 Financy::User* selectedUser;
+Financy::Search::Index searchIndex;
+Financy::Journal* journal;
+Financy::Storage::Repository* repository;
+Financy::Internal* instance;
 
 namespace Financy
 {
@@ -35,25 +35,143 @@ namespace Financy
         return selectedUser;
     }
 
+    Search::Index& Internal::getSearchIndex()
+    {
+        return searchIndex;
+    }
+
+    Journal* Internal::getJournal()
+    {
+        return journal;
+    }
+
+    Storage::Repository& Internal::getRepository()
+    {
+        return *repository;
+    }
+
+    Snapshot::ModelPtr Internal::getSnapshot()
+    {
+        Snapshot::ModelPtr previous = Snapshot::load();
+
+        if (instance == nullptr)
+        {
+            return previous;
+        }
+
+        std::shared_ptr<Snapshot::Model> result = std::make_shared<Snapshot::Model>();
+        result->version = previous->version + 1;
+
+        bool didChange = previous->users.size() != (std::size_t) instance->m_users.size() ||
+            previous->accounts.size() != (std::size_t) instance->m_accounts.size();
+
+        for (User* user : instance->m_users)
+        {
+            std::size_t index = result->users.size();
+            UserData data     = user->toData();
+
+            if (!didChange && *previous->users[index] == data)
+            {
+                result->users.push_back(previous->users[index]);
+
+                continue;
+            }
+
+            result->users.push_back(std::make_shared<const UserData>(std::move(data)));
+
+            didChange = true;
+        }
+
+        for (Account* account : instance->m_accounts)
+        {
+            std::size_t index = result->accounts.size();
+
+            result->accounts.push_back(account->getSnapshot());
+
+            didChange = didChange || result->accounts.back() != previous->accounts[index];
+        }
+
+        if (!didChange)
+        {
+            return previous;
+        }
+
+        Snapshot::publish(result);
+
+        return result;
+    }
+
+    Internal* Internal::create(QQmlEngine* inEngine, QJSEngine* inScriptEngine)
+    {
+        Q_UNUSED(inEngine);
+        Q_UNUSED(inScriptEngine);
+
+        // Owned by the application, the engine must not collect it
+        QJSEngine::setObjectOwnership(instance, QJSEngine::CppOwnership);
+
+        return instance;
+    }
+
+    Context Internal::getContext()
+    {
+        Context result;
+        result.viewerId = selectedUser != nullptr ? (int) selectedUser->getId() : -1;
+        result.asOf     = Globals::getCurrentDate();
+
+        return result;
+    }
+
     Internal::Internal(QObject* parent)
         : QObject(parent),
+        m_storageBackend(Storage::Backend::JSON),
         m_colors(new Colors(parent)),
         m_showcaseColors(new Colors(parent)),
         m_selectedUser(nullptr),
-        m_selectedAccount(nullptr)
+        m_selectedAccount(nullptr),
+        m_forecast(new ForecastModel(this)),
+        m_dashboard(new DashboardModel(this)),
+        m_journal(new Journal(this)),
+        m_repository(nullptr),
+        m_watcher(new Storage::Watcher(this))
     {
+        journal  = m_journal;
+        instance = this;
+
         createFiles();
 
         loadSettings();
+
+        m_repository = Storage::createRepository(m_storageBackend, m_watcher);
+        repository   = m_repository.get();
+
+        m_repository->open();
+
         loadUsers();
         loadAccounts();
         setUsersAccounts();
 
+        // The database keeps its own copy, Data/*.json is only upkept and watched for the JSON store
+        if (m_storageBackend != Storage::Backend::JSON)
+        {
+            return;
+        }
+
         normalizePurchases();
+
+        Storage::Shards::migrate();
+
+        connect(m_watcher, &Storage::Watcher::onUsersChange,    this, [this]() { reloadUsers(); });
+        connect(m_watcher, &Storage::Watcher::onAccountsChange, this, [this]() { reloadAccounts(); });
+        connect(m_watcher, &Storage::Watcher::onShardChange,    this, [this](std::uint32_t _) { reloadPurchases(_); });
+
+        m_watcher->start();
     }
 
     Internal::~Internal()
     {
+        instance   = nullptr;
+        repository = nullptr;
+
         for (User* user : m_users)
         {
             delete user;
@@ -95,56 +213,32 @@ namespace Financy
             return { "#000000", "#FFFFFF" };
         }
 
-        #ifdef OS_WINDOWS
-            std::vector<std::string> splittedUrl = Helper::splitString(
-                inImage.toStdString(),
-                "file:///"
-            );
-        #else
-            std::vector<std::string> splittedUrl = Helper::splitString(
-                inImage.toStdString(),
-                "file://"
-            );
-        #endif
-
-        std::string filePath = splittedUrl[splittedUrl.size() - 1];
-        std::vector<std::string> splittedFilepath = Helper::splitString(
-            filePath,
-            "."
-        );
+        return Image::getColors(QUrl(inImage).toLocalFile().toStdString());
+    }
 
-        std::string fileExtension = splittedFilepath[splittedFilepath.size() - 1];
+    void Internal::requestUserColorsFromImage(const QString& inImage)
+    {
+        if (inImage.isEmpty() || inImage.toStdString().find("qrc://") != std::string::npos)
+        {
+            emit onUserColorsUpdate(inImage, { "#000000", "#FFFFFF" });
 
-        std::vector<char> raw = FileSystem::readFile(filePath);
-        std::string sRaw(raw.begin(), raw.end());
+            return;
+        }
 
-        QImage image;
-        image.loadFromData(
-            QByteArray::fromBase64(
-                base64::to_base64(sRaw).c_str()
-            )
-        );
+        std::string filePath = QUrl(inImage).toLocalFile().toStdString();
 
-        cv::Scalar prominentColor = cv::mean(
-            QtOcv::image2Mat(image)
-        );
+        QThreadPool::globalInstance()->start(
+            [this, inImage, filePath]()
+            {
+                QList<QColor> colors = Image::getColors(filePath);
 
-        QColor primaryColor = QColor(
-            prominentColor[0], // R
-            prominentColor[1], // G
-            prominentColor[2]  // B
-        );
-        QColor secondaryColor = QColor(
-            255 - primaryColor.red(),
-            255 - primaryColor.green(),
-            255 - primaryColor.blue()
+                QMetaObject::invokeMethod(
+                    this,
+                    [this, inImage, colors]() { emit onUserColorsUpdate(inImage, colors); },
+                    Qt::QueuedConnection
+                );
+            }
         );
-
-        QList<QColor> result;
-        result.push_back(primaryColor);
-        result.push_back(secondaryColor);
-
-        return result;
     }
 
     User* Internal::getUser(std::uint32_t inId)
@@ -230,17 +324,11 @@ namespace Financy
             return nullptr;
         }
 
-        std::ifstream file(USER_FILE_NAME);
-        nlohmann::ordered_json users = FileSystem::doesFileExist(USER_FILE_NAME) ? 
-            nlohmann::ordered_json::parse(file):
-            nlohmann::ordered_json::array();
-
         std::uint32_t id = 0;
 
-        if (users.size() > 0)
+        for (User* user : m_users)
         {
-            id = (std::uint32_t) users[users.size() - 1].at("id");
-            id++;
+            id = std::max(id, user->getId() + 1);
         }
 
         User* user = new User();
@@ -256,11 +344,7 @@ namespace Financy
 
         onUsersUpdate();
 
-        // Write
-        users.push_back(user->toJSON());
-
-        std::ofstream stream(USER_FILE_NAME);
-        stream << std::setw(4) << users << std::endl;
+        writeUsers();
 
         return user;
     }
@@ -275,11 +359,6 @@ namespace Financy
         const QColor& inSecondaryColor
     )
     {
-        if (!FileSystem::doesFileExist(USER_FILE_NAME))
-        {
-            return;
-        }
-
         User* user = getUser(inId);
 
         if (!user)
@@ -287,13 +366,6 @@ namespace Financy
             return;
         }
 
-        nlohmann::ordered_json users = nlohmann::ordered_json::parse(std::ifstream(USER_FILE_NAME));
-
-        if (!users.is_array())
-        {
-            return;
-        }
-
         user->edit(
             inFirstName,
             inLastName,
@@ -303,28 +375,7 @@ namespace Financy
             inSecondaryColor
         );
 
-        nlohmann::ordered_json updatedUsers = nlohmann::ordered_json::array();
-
-        for (auto& [key, data] : users.items())
-        {
-            if (data.find("id") == data.end() || !data.at("id").is_number_unsigned())
-            {
-                continue;
-            }
-
-            if ((int) data.at("id") != inId)
-            {
-                updatedUsers.push_back(data);
-
-                continue;
-            }
-
-            updatedUsers.push_back(m_selectedUser->toJSON());
-        }
-
-        // Write
-        std::ofstream stream(USER_FILE_NAME);
-        stream << std::setw(4) << updatedUsers << std::endl;
+        writeUsers();
 
         emit onSelectUserUpdate();
         emit onUsersUpdate();
@@ -341,11 +392,33 @@ namespace Financy
         
         login(inId);
 
+        Change change;
+        change.type   = Change::Type::DeleteUser;
+        change.userId = inId;
+        change.users  = { user->toData() };
+
+        for (Account* account : user->getAccounts())
+        {
+            if (!account->isOwnedBy(user))
+            {
+                change.sharedAccountIds.push_back(account->getId());
+
+                continue;
+            }
+
+            change.accounts.push_back(getAccountData(account));
+        }
+
+        // The cascade below is part of this change, not one entry per account
+        m_journal->pause();
+
         for (Account* account : user->getAccounts())
         {
             deleteAccount(account->getId());
         }
 
+        m_journal->resume();
+
         user->remove();
 
         m_users.removeAt(
@@ -356,11 +429,15 @@ namespace Financy
             ) - m_users.begin()
         );
 
+        writeUsers();
+
         logout();
 
         emit onUsersUpdate();
 
         delete user;
+
+        m_journal->record(std::move(change));
     }
 
     void Internal::login(std::uint32_t inId)
@@ -399,6 +476,8 @@ namespace Financy
         }
 
         m_selectedUser->logout();
+        m_forecast->clear();
+        m_dashboard->clear();
         m_selectedUser = nullptr;
 
         setSelectedUser(m_selectedUser);
@@ -504,22 +583,11 @@ namespace Financy
             return;
         }
 
-        std::ifstream file(ACCOUNT_FILE_NAME);
-        nlohmann::ordered_json accounts = FileSystem::doesFileExist(ACCOUNT_FILE_NAME) ? 
-            nlohmann::ordered_json::parse(file):
-            nlohmann::ordered_json::array();
-
-        if (!accounts.is_array())
-        {
-            return;
-        }
-
         std::uint32_t id = 0;
 
-        if (accounts.size() > 0)
+        for (Account* account : m_accounts)
         {
-            id = (std::uint32_t) accounts[accounts.size() - 1].at("id");
-            id++;
+            id = std::max(id, account->getId() + 1);
         }
 
         Account* account = new Account();
@@ -578,20 +646,6 @@ namespace Financy
             return;
         }
 
-        if (!FileSystem::doesFileExist(ACCOUNT_FILE_NAME))
-        {
-            return;
-        }
-
-        nlohmann::ordered_json accounts = nlohmann::ordered_json::parse(std::ifstream(ACCOUNT_FILE_NAME));
-
-        if (!accounts.is_array())
-        {
-            return;
-        }
-
-        nlohmann::ordered_json updatedAccounts = nlohmann::ordered_json::array();
-
         Account* account = getAccount(inId);
 
         if (account == nullptr)
@@ -647,6 +701,16 @@ namespace Financy
             return;
         }
 
+        Change change;
+        change.type      = Change::Type::DeleteAccount;
+        change.userId    = m_selectedUser->getId();
+        change.accountId = inId;
+
+        if (account->isOwnedBy(m_selectedUser))
+        {
+            change.accounts = { getAccountData(account) };
+        }
+
         m_selectedUser->deleteAccount(account);
 
         if (account->isOwnedBy(m_selectedUser))
@@ -666,6 +730,8 @@ namespace Financy
         emit onAccountsUpdate();
 
         writeAccounts();
+
+        m_journal->record(std::move(change));
     }
 
     void Internal::mergeAccounts(
@@ -694,7 +760,42 @@ namespace Financy
             return;
         }
 
-        targetAccount->addPurchases(sourceAccount->getPurchases());
+        // A loaded target takes the source rows from memory, they have to be read before the
+        // move empties the source shard
+        if (targetAccount->didFetchPurchases())
+        {
+            sourceAccount->refreshPurchases();
+        }
+
+        m_repository->movePurchases(
+            sourceAccount->getId(),
+            targetAccount->getId()
+        );
+
+        if (targetAccount->didFetchPurchases())
+        {
+            QList<Purchase*> purchases = sourceAccount->getPurchases();
+
+            // Same rule as the shard move above, so memory and disk agree
+            for (Purchase* purchase : Search::takeDuplicates(targetAccount->getFingerprints(), purchases))
+            {
+                searchIndex.remove(purchase->getId());
+
+                purchase->deleteLater();
+            }
+
+            targetAccount->addPurchases(purchases);
+        }
+        else
+        {
+            // Target is loaded from its shard on the next refresh
+            for (Purchase* purchase : sourceAccount->getPurchases())
+            {
+                purchase->deleteLater();
+            }
+
+            searchIndex.removeAccount(sourceAccount->getId());
+        }
 
         m_selectedUser->removeAccount(sourceAccount);
         m_selectedUser->addAccount(targetAccount);
@@ -751,6 +852,87 @@ namespace Financy
         emit onSelectAccountUpdate();
     }
 
+    bool Internal::undo()
+    {
+        return m_journal->undo([this](const Change& _) { return revert(_); });
+    }
+
+    bool Internal::redo()
+    {
+        return m_journal->redo([this](const Change& _) { return replay(_); });
+    }
+
+    QList<int> Internal::search(const QString& inQuery, const QVariantMap& inFilters)
+    {
+        if (m_selectedUser == nullptr)
+        {
+            return {};
+        }
+
+        Search::Filter filter;
+
+        // Same visibility as Account::getPurchases, shared accounts only show the user's own purchases
+        for (Account* account : m_selectedUser->getAccounts())
+        {
+            if (inFilters.contains("accountId") && account->getId() != inFilters.value("accountId").toUInt())
+            {
+                continue;
+            }
+
+            filter.accounts[account->getId()] = account->isOwnedBy(m_selectedUser) ?
+                -1 :
+                (int) m_selectedUser->getId();
+        }
+
+        if (filter.accounts.empty())
+        {
+            return {};
+        }
+
+        if (inFilters.contains("userId"))
+        {
+            filter.userId = inFilters.value("userId").toInt();
+        }
+
+        if (inFilters.contains("type"))
+        {
+            filter.type = (int) Purchase::getTypeValue(inFilters.value("type").toString());
+        }
+
+        auto toDate = [](const QVariant& inValue)
+        {
+            return inValue.typeId() == QMetaType::QDate ?
+                inValue.toDate() :
+                QDate::fromString(inValue.toString(), "dd/MM/yyyy");
+        };
+
+        if (inFilters.contains("from"))
+        {
+            filter.from = toDate(inFilters.value("from")).toJulianDay();
+        }
+
+        if (inFilters.contains("to"))
+        {
+            filter.to = toDate(inFilters.value("to")).toJulianDay();
+        }
+
+        int limit = inFilters.contains("limit") ? inFilters.value("limit").toInt() : -1;
+
+        QList<int> result {};
+
+        for (const Search::Hit& hit : searchIndex.search(inQuery, filter))
+        {
+            if (limit >= 0 && result.size() >= limit)
+            {
+                break;
+            }
+
+            result.push_back(hit.id);
+        }
+
+        return result;
+    }
+
     void Internal::updateTheme(Colors::Theme inTheme)
     {
         m_colorsTheme = inTheme;
@@ -908,6 +1090,22 @@ namespace Financy
         std::string dataFolderPath = DATA_FOLDER_NAME;
         dataFolderPath.append("/");
 
+        for (const char* filePath : LEGACY_FILES)
+        {
+            std::string fileName = Helper::splitString(
+                filePath,
+                dataFolderPath
+            )[1];
+
+            if (FileSystem::doesFileExist(fileName) && !FileSystem::doesFileExist(filePath))
+            {
+                std::filesystem::rename(
+                    fileName,
+                    filePath
+                );
+            }
+        }
+
         for (const char* filePath : FILES)
         {
             std::string fileName = Helper::splitString(
@@ -957,33 +1155,34 @@ namespace Financy
         props.name.append(m_selectedUser->getFirstName().toStdString());
         props.name.append("_");
         props.name.append(getCurrentDate().toString("dd-MM-yy").toStdString());
-        props.user = m_selectedUser;
+        props.user    = m_selectedUser;
+        props.context = getContext();
 
         Report::generatreUserReport(props);
     }
 
     void Internal::loadUsers()
     {
-        if (!FileSystem::doesFileExist(USER_FILE_NAME))
+        bool didMigrate = false;
+
+        for (User* user : m_repository->readUsers())
         {
-            return;
-        }
+            didMigrate = didMigrate || user->didMigratePicture();
 
-        std::ifstream file(USER_FILE_NAME);
-        nlohmann::json users = nlohmann::json::parse(file);
+            m_users.push_back(user);
+        }
 
-        if (!users.is_array())
+        if (!didMigrate)
         {
             return;
         }
 
-        for (auto& it : users.items())
-        {
-            User* user = new User();
-            user->fromJSON(it.value());
+        writeUsers();
+    }
 
-            m_users.push_back(user);
-        }
+    void Internal::writeUsers()
+    {
+        m_repository->writeUsers(m_users);
     }
 
     void Internal::setUsersAccounts()
@@ -1008,24 +1207,8 @@ namespace Financy
 
     void Internal::loadAccounts()
     {
-        if (!FileSystem::doesFileExist(ACCOUNT_FILE_NAME))
-        {
-            return;
-        }
-
-        std::ifstream file(ACCOUNT_FILE_NAME);
-        nlohmann::json accounts = nlohmann::json::parse(file);
-
-        if (!accounts.is_array())
-        {
-            return;
-        }
-
-        for (auto& it : accounts.items())
+        for (Account* account : m_repository->readAccounts())
         {
-            Account* account = new Account();
-            account->fromJSON(it.value());
-
             if (getUser(account->getUserId()) == nullptr)
             {
                 delete account;
@@ -1050,22 +1233,9 @@ namespace Financy
 
     void Internal::writeAccounts()
     {
-        if (!FileSystem::doesFileExist(ACCOUNT_FILE_NAME))
-        {
-            return;
-        }
-
-        nlohmann::ordered_json accounts = nlohmann::ordered_json::array();
-
         sortAccounts();
 
-        for (Account* account : m_accounts)
-        {
-            accounts.push_back(account->toJSON());
-        }
-
-        std::ofstream stream(ACCOUNT_FILE_NAME);
-        stream << std::setw(4) << accounts << std::endl;
+        m_repository->writeAccounts(m_accounts);
     }
 
     void Internal::addAccount(Account* inAccount)
@@ -1090,15 +1260,449 @@ namespace Financy
         emit onAccountsUpdate();
     }
 
-    void Internal::loadSettings()
+    bool Internal::revert(const Change& inChange)
+    {
+        switch (inChange.type)
+        {
+            case Change::Type::DeletePurchases:
+            {
+                Account* account = getAccount(inChange.accountId);
+
+                if (account == nullptr)
+                {
+                    return false;
+                }
+
+                QList<Purchase*> purchases {};
+
+                for (const PurchaseData& data : inChange.purchases)
+                {
+                    Purchase* purchase = new Purchase();
+                    purchase->fromData(data);
+
+                    purchases.push_back(purchase);
+                }
+
+                account->restorePurchases(purchases);
+
+                return true;
+            }
+            case Change::Type::DeleteAccount:
+            {
+                User* user = getUser(inChange.userId);
+
+                if (user == nullptr)
+                {
+                    return false;
+                }
+
+                // Leaving a shared account, it is still around
+                if (inChange.accounts.empty())
+                {
+                    Account* account = getAccount(inChange.accountId);
+
+                    if (account == nullptr)
+                    {
+                        return false;
+                    }
+
+                    user->addAccount(account);
+                }
+                else if (restoreAccount(inChange.accounts[0]) == nullptr)
+                {
+                    return false;
+                }
+
+                emit onAccountsUpdate();
+
+                writeAccounts();
+
+                return true;
+            }
+            case Change::Type::DeleteUser:
+            {
+                if (inChange.users.empty() || getUser(inChange.users[0].id) != nullptr)
+                {
+                    return false;
+                }
+
+                User* user = new User();
+                user->fromData(inChange.users[0]);
+
+                m_users.insert(
+                    std::lower_bound(
+                        m_users.begin(),
+                        m_users.end(),
+                        user,
+                        [](User* a, User* b) { return a->getId() < b->getId(); }
+                    ),
+                    user
+                );
+
+                for (const AccountData& data : inChange.accounts)
+                {
+                    restoreAccount(data);
+                }
+
+                for (std::uint32_t id : inChange.sharedAccountIds)
+                {
+                    user->addAccount(getAccount(id));
+                }
+
+                writeUsers();
+                writeAccounts();
+
+                emit onUsersUpdate();
+                emit onAccountsUpdate();
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool Internal::replay(const Change& inChange)
+    {
+        switch (inChange.type)
+        {
+            case Change::Type::DeletePurchases:
+            {
+                Account* account = getAccount(inChange.accountId);
+
+                if (account == nullptr)
+                {
+                    return false;
+                }
+
+                QList<std::uint32_t> ids {};
+
+                for (const PurchaseData& data : inChange.purchases)
+                {
+                    ids.push_back(data.id);
+                }
+
+                account->applyChanges({}, ids);
+
+                return true;
+            }
+            case Change::Type::DeleteAccount:
+            {
+                if (m_selectedUser == nullptr || m_selectedUser->getId() != inChange.userId)
+                {
+                    return false;
+                }
+
+                deleteAccount(inChange.accountId);
+
+                return true;
+            }
+            case Change::Type::DeleteUser:
+            {
+                if (inChange.users.empty() || getUser(inChange.users[0].id) == nullptr)
+                {
+                    return false;
+                }
+
+                deleteUser(inChange.users[0].id);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void Internal::reloadUsers()
+    {
+        FileSystem::MappedFile file(USER_FILE_NAME);
+
+        if (!file.isOpen())
+        {
+            return;
+        }
+
+        nlohmann::json users = nlohmann::json::parse(file.getData(), file.getData() + file.getSize(), nullptr, false);
+
+        if (!users.is_array())
+        {
+            return;
+        }
+
+        std::unordered_set<std::uint32_t> storedIds {};
+        bool didChange = false;
+
+        for (auto& [key, data] : users.items())
+        {
+            if (data.find("id") == data.end() || !data.at("id").is_number_unsigned())
+            {
+                continue;
+            }
+
+            std::uint32_t id = data.at("id");
+            storedIds.insert(id);
+
+            User* user = getUser(id);
+
+            if (user == nullptr)
+            {
+                user = new User();
+                user->fromJSON(data);
+
+                m_users.insert(
+                    std::lower_bound(
+                        m_users.begin(),
+                        m_users.end(),
+                        user,
+                        [](User* a, User* b) { return a->getId() < b->getId(); }
+                    ),
+                    user
+                );
+
+                didChange = true;
+
+                continue;
+            }
+
+            if (Storage::getContentHash(user->toJSON()) == Storage::getContentHash(data))
+            {
+                continue;
+            }
+
+            user->fromJSON(data);
+
+            didChange = true;
+        }
+
+        for (User* user : QList<User*>(m_users))
+        {
+            if (storedIds.find(user->getId()) != storedIds.end())
+            {
+                continue;
+            }
+
+            if (m_selectedUser != nullptr && m_selectedUser->getId() == user->getId())
+            {
+                deselect();
+                logout();
+            }
+
+            m_users.removeAll(user);
+
+            user->deleteLater();
+
+            didChange = true;
+        }
+
+        if (!didChange)
+        {
+            return;
+        }
+
+        setUsersAccounts();
+
+        emit onUsersUpdate();
+        emit onSelectUserUpdate();
+    }
+
+    void Internal::reloadAccounts()
     {
-        if (!FileSystem::doesFileExist(SETTINGS_FILE_NAME))
+        FileSystem::MappedFile file(ACCOUNT_FILE_NAME);
+
+        if (!file.isOpen())
         {
             return;
         }
 
-        std::ifstream file(SETTINGS_FILE_NAME);
-        nlohmann::json settings = nlohmann::json::parse(file);
+        nlohmann::json accounts = nlohmann::json::parse(file.getData(), file.getData() + file.getSize(), nullptr, false);
+
+        if (!accounts.is_array())
+        {
+            return;
+        }
+
+        std::unordered_set<std::uint32_t> storedIds {};
+        bool didChange = false;
+
+        for (auto& [key, data] : accounts.items())
+        {
+            if (data.find("id") == data.end() || !data.at("id").is_number_unsigned())
+            {
+                continue;
+            }
+
+            std::uint32_t id = data.at("id");
+            Account* account = getAccount(id);
+
+            if (account == nullptr)
+            {
+                account = new Account();
+                account->fromJSON(data);
+
+                // Same rule as loadAccounts, no accounts without an owner
+                if (getUser(account->getUserId()) == nullptr)
+                {
+                    delete account;
+
+                    continue;
+                }
+
+                storedIds.insert(id);
+
+                addAccount(account);
+
+                didChange = true;
+
+                continue;
+            }
+
+            if (getUser(account->getUserId()) == nullptr)
+            {
+                continue;
+            }
+
+            storedIds.insert(id);
+
+            // Compared after parsing, toJSON writes the type and shared ids as signed numbers while
+            // the file reads back unsigned, so their json hashes never match
+            Account stored;
+            stored.fromJSON(data);
+
+            if (stored.toData() == account->toData())
+            {
+                continue;
+            }
+
+            account->fromJSON(data);
+
+            if (m_selectedAccount == account)
+            {
+                account->refreshHistory();
+            }
+
+            didChange = true;
+        }
+
+        for (Account* account : QList<Account*>(m_accounts))
+        {
+            if (storedIds.find(account->getId()) != storedIds.end())
+            {
+                continue;
+            }
+
+            if (m_selectedAccount == account)
+            {
+                deselect();
+            }
+
+            account->clearPurchases();
+
+            removeAccount(account);
+
+            account->deleteLater();
+
+            didChange = true;
+        }
+
+        if (!didChange)
+        {
+            return;
+        }
+
+        setUsersAccounts();
+
+        // Accounts that showed up for the logged in user are fetched like on login
+        if (m_selectedUser != nullptr)
+        {
+            m_selectedUser->login();
+        }
+
+        emit onAccountsUpdate();
+        emit onSelectUserUpdate();
+    }
+
+    void Internal::reloadPurchases(std::uint32_t inAccountId)
+    {
+        Account* account = getAccount(inAccountId);
+
+        // Accounts that were never fetched read their shard fresh on first use
+        if (account == nullptr || !account->didFetchPurchases())
+        {
+            return;
+        }
+
+        account->reloadPurchases(m_repository->readPurchases(inAccountId));
+    }
+
+    AccountData Internal::getAccountData(Account* inAccount)
+    {
+        inAccount->refreshPurchases();
+
+        AccountData result = inAccount->toData();
+
+        for (Purchase* purchase : inAccount->getPurchases())
+        {
+            result.purchases.push_back(purchase->toData());
+        }
+
+        return result;
+    }
+
+    Account* Internal::restoreAccount(const AccountData& inData)
+    {
+        if (getAccount(inData.id) != nullptr)
+        {
+            return nullptr;
+        }
+
+        Account* account = new Account();
+        account->fromData(inData);
+
+        QList<Purchase*> purchases {};
+
+        for (const PurchaseData& data : inData.purchases)
+        {
+            Purchase* purchase = new Purchase();
+            purchase->fromData(data);
+
+            purchases.push_back(purchase);
+        }
+
+        // Same incremental path as any other insert: index, sort, history and one shard write
+        account->restorePurchases(purchases);
+
+        addAccount(account);
+
+        for (User* user : getUsers(inData.sharedUserIds))
+        {
+            user->addAccount(account);
+        }
+
+        User* owner = getUser(inData.userId);
+
+        if (owner != nullptr)
+        {
+            owner->addAccount(account);
+        }
+
+        return account;
+    }
+
+    void Internal::loadSettings()
+    {
+        nlohmann::json settings = nullptr;
+
+        // updateTheme() rewrites the file, the mapping has to be gone by then
+        {
+            FileSystem::MappedFile file(SETTINGS_FILE_NAME);
+
+            if (!file.isOpen())
+            {
+                return;
+            }
+
+            settings = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+        }
 
         if (!settings.is_object())
         {
@@ -1107,20 +1711,32 @@ namespace Financy
 
         bool hasColorTheme = settings.find("colorTheme") != settings.end() || settings.at("colorTheme").is_number_unsigned();
         updateTheme(hasColorTheme ? (Colors::Theme) settings.at("colorTheme") : m_colorsTheme);
+
+        // "sqlite" moves everything into Data/Financy.db on the next start, the JSON files are left as they were
+        bool hasStorage = settings.find("storage") != settings.end() && settings.at("storage").is_string();
+        m_storageBackend = hasStorage && settings.at("storage") == "sqlite" ?
+            Storage::Backend::SQLite :
+            Storage::Backend::JSON;
     }
 
     void Internal::writeSettings()
     {
-        std::ifstream file(SETTINGS_FILE_NAME);
-        nlohmann::json settings = FileSystem::doesFileExist(SETTINGS_FILE_NAME) ? 
-            nlohmann::json::parse(file):
-            nlohmann::json::object();
+        nlohmann::json settings = nlohmann::json::object();
+
+        // The mapping goes before the file is replaced
+        {
+            FileSystem::MappedFile file(SETTINGS_FILE_NAME);
+
+            if (file.isOpen())
+            {
+                settings = nlohmann::json::parse(file.getData(), file.getData() + file.getSize());
+            }
+        }
 
         settings["colorTheme"] = (int) m_colorsTheme;
 
         // Write
-        std::ofstream stream(SETTINGS_FILE_NAME);
-        stream << std::setw(4) << settings << std::endl;
+        FileSystem::writeFile(SETTINGS_FILE_NAME, settings.dump(4) + "\n");
     }
 
     void Internal::reloadTheme()
@@ -1171,76 +1787,18 @@ namespace Financy
 
     void Internal::normalizePurchases()
     {
-        if (!FileSystem::doesFileExist(PURCHASE_FILE_NAME))
-        {
-            return;
-        }
+        std::unordered_map<std::uint32_t, std::uint32_t> owners {};
 
-        std::ifstream file(PURCHASE_FILE_NAME);
-
-        nlohmann::json purchases    = nlohmann::json::parse(file);
-        nlohmann::json newPurchases = nlohmann::json::array();
-
-        if (!purchases.is_array())
-        {
-            return;
-        }
-
-        bool didNormalize = false;
-
-        for (auto& it : purchases.items())
+        for (Account* account : m_accounts)
         {
-            auto purchase = it.value();
-
-            if (purchase.find("userId") != purchase.end())
-            {
-                newPurchases.push_back(purchase);
-
-                continue;
-            }
-
-            Account* account = getAccount((std::uint32_t) purchase.at("accountId"));
-
-            if (account == nullptr)
-            {
-                newPurchases.push_back(purchase);
-
-                continue;
-            }
-
-            User* buyer = getUser(account->getUserId());
-
-            if (buyer == nullptr)
+            if (getUser(account->getUserId()) == nullptr)
             {
-                newPurchases.push_back(purchase);
-
                 continue;
             }
 
-            newPurchases.push_back(
-                {
-                    { "id",           purchase.at("id") },
-                    { "userId",       buyer->getId() },
-                    { "accountId",    purchase.at("accountId") },
-                    { "name",         purchase.at("name") },
-                    { "description",  purchase.at("description") },
-                    { "date",         purchase.at("date") },
-                    { "type",         purchase.at("type") },
-                    { "value",        purchase.at("value") },
-                    { "installments", purchase.at("installments") }
-                }
-            );
-
-            didNormalize = true;
+            owners[account->getId()] = account->getUserId();
         }
 
-        if (!didNormalize)
-        {
-            return;
-        }
-
-        // Write
-        std::ofstream stream(PURCHASE_FILE_NAME);
-        stream << std::setw(4) << newPurchases << std::endl;
+        Storage::Shards::normalize(owners);
     }
 }
\ No newline at end of file
@@ -1,16 +1,27 @@
 #pragma once
 
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 #include <QMetaType>
+#include <QQmlEngine>
 
 #include "Colors.hpp"
+#include "DashboardModel.hpp"
+#include "ForecastModel.hpp"
+#include "Core/Journal.hpp"
+#include "Core/Snapshot.hpp"
 #include "User.hpp"
+#include "Search/Index.hpp"
+#include "Storage/Repository.hpp"
+#include "Storage/Watcher.hpp"
 
 namespace Financy
 {
     class Internal : public QObject
     {
         Q_OBJECT
+        QML_ELEMENT
+        QML_SINGLETON
 
         // Theme
         Q_PROPERTY(
@@ -58,6 +69,25 @@ namespace Financy
             NOTIFY onAccountsUpdate
         )
 
+        // Stats
+        Q_PROPERTY(
+            ForecastModel* forecast
+            MEMBER m_forecast
+            CONSTANT
+        )
+        Q_PROPERTY(
+            DashboardModel* dashboard
+            MEMBER m_dashboard
+            CONSTANT
+        )
+
+        // History
+        Q_PROPERTY(
+            Journal* journal
+            MEMBER m_journal
+            CONSTANT
+        )
+
     signals:
         void onThemeUpdate();
         void onShowcaseThemeUpdate();
@@ -68,10 +98,26 @@ namespace Financy
         void onSelectAccountUpdate();
         void onAccountsUpdate();
 
+        void onUserColorsUpdate(const QString& inImage, const QList<QColor>& inColors);
+
     public:
         static void setSelectedUser(User* inUser);
         static User* getSelectedUser();
 
+        static Search::Index& getSearchIndex();
+        static Journal* getJournal();
+        static Storage::Repository& getRepository();
+
+        // Logged in user and app date, for the QML facing wrappers. UI thread only
+        static Context getContext();
+
+        // Publishes pending edits as a new version and pins it for the caller. UI thread only,
+        // other threads read the last published one with Snapshot::load()
+        static Snapshot::ModelPtr getSnapshot();
+
+        // QML singleton factory, hands out the instance the application created
+        static Internal* create(QQmlEngine* inEngine, QJSEngine* inScriptEngine);
+
     public:
         Internal(QObject* parent = nullptr);
         ~Internal();
@@ -83,6 +129,7 @@ namespace Financy
             const QString& inExtensions
         );
         QList<QColor> getUserColorsFromImage(const QString& inImage);
+        void requestUserColorsFromImage(const QString& inImage);
 
         // User
         User* getUser(std::uint32_t inId);
@@ -141,6 +188,13 @@ namespace Financy
         void select(std::uint32_t inId);
         void deselect();
 
+        // History
+        bool undo();
+        bool redo();
+
+        // Search
+        QList<int> search(const QString& inQuery, const QVariantMap& inFilters = {});
+
         // Theme
         void updateTheme(Colors::Theme inTheme);
         void updateShowcaseTheme(Colors::Theme inTheme);
@@ -180,6 +234,7 @@ namespace Financy
     private:
         // User
         void loadUsers();
+        void writeUsers();
         void setUsersAccounts();
 
         // Account
@@ -190,6 +245,18 @@ namespace Financy
         void addAccount(Account* inAccount);
         void removeAccount(Account* inAccount);
 
+        // History
+        bool revert(const Change& inChange);
+        bool replay(const Change& inChange);
+
+        AccountData getAccountData(Account* inAccount);
+        Account* restoreAccount(const AccountData& inData);
+
+        // External edits, only entities whose content hash moved are touched
+        void reloadUsers();
+        void reloadAccounts();
+        void reloadPurchases(std::uint32_t inAccountId);
+
         // Settings
         void loadSettings();
         void writeSettings();
@@ -204,6 +271,7 @@ namespace Financy
     private:
         // Settings
         Colors::Theme m_colorsTheme;
+        Storage::Backend m_storageBackend;
 
         // Theme
         Colors* m_colors;
@@ -218,5 +286,15 @@ namespace Financy
         // Account
         Account* m_selectedAccount;
         QList<Account*> m_accounts;
+
+        // Stats
+        ForecastModel* m_forecast;
+        DashboardModel* m_dashboard;
+
+        // History
+        Journal* m_journal;
+
+        std::unique_ptr<Storage::Repository> m_repository;
+        Storage::Watcher* m_watcher;
     };
 }
\ No newline at end of file
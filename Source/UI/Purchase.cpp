@@ -1,6 +1,7 @@
 #include "Purchase.hpp"
 
 #include "Base.hpp"
+#include "Storage/Writer.hpp"
 #include "UI/User.hpp"
 
 #include <QQmlEngine>
@@ -17,15 +18,7 @@ namespace Financy
         m_installments(1),
         m_hasEnded(false),
         m_endDate(QDate::currentDate())
-    {
-        qmlRegisterUncreatableType<Purchase>(
-            "Financy.Types",
-            1,
-            0,
-            "Purchase",
-            "Internal use only"
-        );
-    }
+    {}
 
     Purchase::Type Purchase::getTypeValue(const QString& inName)
     {
@@ -61,9 +54,30 @@ namespace Financy
         return m_userId == inUserId;
     }
 
+    bool Purchase::isRecurring(Type inType)
+    {
+        return inType == Type::Bill || inType == Type::Subscription;
+    }
+
+    std::uint32_t Purchase::getRecurringInstallments(const QDate& inDate, const QDate& inEndDate)
+    {
+        int paidInstallments = 0;
+
+        QDate currentDate = inDate;
+
+        while (currentDate.daysTo(inEndDate) > 0)
+        {
+            paidInstallments++;
+
+            currentDate = currentDate.addMonths(1);
+        }
+
+        return paidInstallments;
+    }
+
     bool Purchase::isRecurring()
     {
-        return m_type == Type::Bill || m_type == Type::Subscription;
+        return isRecurring(m_type);
     }
 
     bool Purchase::hasEnded()
@@ -192,6 +206,101 @@ namespace Financy
         return result;
     }
 
+    void Purchase::write(Storage::Writer& outWriter)
+    {
+        // Same fields and order as toJSON
+        outWriter.beginObject();
+        outWriter.key("id").value(          m_id);
+        outWriter.key("userId").value(      m_userId);
+        outWriter.key("accountId").value(   m_accountId);
+        outWriter.key("name").value(        m_name);
+        outWriter.key("description").value( m_description);
+        outWriter.key("type").value(        (int) m_type);
+        outWriter.key("value").value(       m_value);
+        outWriter.key("installments").value(m_installments);
+        outWriter.key("date").value(        m_date);
+
+        if (hasEnded())
+        {
+            outWriter.key("endDate").value(m_endDate);
+        }
+
+        outWriter.endObject();
+    }
+
+    void Purchase::fromData(const PurchaseData& inData)
+    {
+        setId(          inData.id);
+        setUserId(      inData.userId);
+        setAccountId(   inData.accountId);
+        setName(        inData.name);
+        setDescription( inData.description);
+        setDate(        inData.date);
+        setType(        inData.type);
+        setValue(       inData.value);
+        setInstallments(inData.installments);
+        setEndDate(     inData.endDate);
+        setHasEnded(    inData.hasEnded);
+    }
+
+    PurchaseData Purchase::toData()
+    {
+        PurchaseData result;
+        result.id           = m_id;
+        result.userId       = m_userId;
+        result.accountId    = m_accountId;
+        result.name         = m_name;
+        result.description  = m_description;
+        result.date         = m_date;
+        result.type         = m_type;
+        result.value        = m_value;
+        result.installments = m_installments;
+        result.hasEnded     = m_hasEnded;
+        result.endDate      = m_endDate;
+
+        return result;
+    }
+
+    bool PurchaseData::isRecurring() const
+    {
+        return Purchase::isRecurring(type);
+    }
+
+    float PurchaseData::getInstallmentValue() const
+    {
+        return value / installments;
+    }
+
+    std::uint32_t PurchaseData::getInstallments() const
+    {
+        if (isRecurring() && hasEnded)
+        {
+            return Purchase::getRecurringInstallments(date, endDate);
+        }
+
+        return installments;
+    }
+
+    std::size_t PurchaseData::getSize() const
+    {
+        return sizeof(PurchaseData) + (name.size() + description.size()) * sizeof(QChar);
+    }
+
+    bool PurchaseData::operator==(const PurchaseData& inOther) const
+    {
+        return id == inOther.id &&
+            userId == inOther.userId &&
+            accountId == inOther.accountId &&
+            name == inOther.name &&
+            description == inOther.description &&
+            date == inOther.date &&
+            type == inOther.type &&
+            value == inOther.value &&
+            installments == inOther.installments &&
+            hasEnded == inOther.hasEnded &&
+            endDate == inOther.endDate;
+    }
+
     bool Purchase::isOwnedBy(User* inUser)
     {
         if (inUser == nullptr)
@@ -352,18 +461,7 @@ namespace Financy
     {
         if (isRecurring() && hasEnded())
         {
-            int paidInstallments = 0;
-
-            QDate currentDate = m_date;
-
-            while (currentDate.daysTo(m_endDate) > 0)
-            {
-                paidInstallments++;
-
-                currentDate = currentDate.addMonths(1);
-            }
-
-            return paidInstallments;
+            return getRecurringInstallments(m_date, m_endDate);
         }
 
         return m_installments;
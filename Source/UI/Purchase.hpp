@@ -3,6 +3,7 @@
 #include <unordered_map>
 
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 #include <QDate>
 
 #include <nlohmann/json.hpp>
@@ -10,9 +11,18 @@
 namespace Financy
 {
     class User;
+    struct PurchaseData;
+
+    namespace Storage
+    {
+        class Writer;
+    }
+
     class Purchase : public QObject
     {
         Q_OBJECT
+        QML_ELEMENT
+        QML_UNCREATABLE("Internal use only")
 
         // Properties
         Q_PROPERTY(
@@ -83,6 +93,10 @@ namespace Financy
         static Type getTypeValue(const QString& inName);
         static QString getTypeName(Type inType);
 
+        // Shared with PurchaseData so snapshots follow the same rules
+        static bool isRecurring(Type inType);
+        static std::uint32_t getRecurringInstallments(const QDate& inDate, const QDate& inEndDate);
+
     public slots:
         bool isOwnedBy(std::uint32_t inUserId);
 
@@ -97,6 +111,10 @@ namespace Financy
     public:
         void fromJSON(const nlohmann::json& inData);
         nlohmann::ordered_json toJSON();
+        void write(Storage::Writer& outWriter);
+
+        void fromData(const PurchaseData& inData);
+        PurchaseData toData();
 
     public:
         bool isOwnedBy(User* inUser);
@@ -164,6 +182,34 @@ namespace Financy
         QDate m_endDate;
     };
 
+    // Plain copy of a purchase's fields, cheap to keep around without a QObject or a JSON tree
+    struct PurchaseData
+    {
+        std::uint32_t id        = 0;
+        std::uint32_t userId    = 0;
+        std::uint32_t accountId = 0;
+
+        QString name;
+        QString description;
+        QDate date;
+        Purchase::Type type = Purchase::Type::Other;
+
+        float value                = 0.0f;
+        std::uint32_t installments = 1;
+
+        bool hasEnded = false;
+        QDate endDate;
+
+        bool isRecurring() const;
+        float getInstallmentValue() const;
+        std::uint32_t getInstallments() const;
+
+        // Approximate bytes held, strings included
+        std::size_t getSize() const;
+
+        bool operator==(const PurchaseData& inOther) const;
+    };
+
     static std::unordered_map<std::string, Purchase::Type> PURCHASE_TYPES = {
         { "Debt",         Purchase::Type::Debt },
         { "Food",         Purchase::Type::Food },
@@ -0,0 +1,237 @@
+#include "Simulation.hpp"
+
+#include <limits>
+
+#include <QQmlEngine>
+
+#include "UI/Account.hpp"
+#include "UI/Internal.hpp"
+
+namespace Financy
+{
+    Simulation::Simulation(Account* inAccount, QObject* parent)
+        : QObject(parent),
+        m_account(inAccount),
+        m_context(Internal::getContext()),
+        m_usedLimit(inAccount->getUsedLimit(m_context)),
+        m_rollup(inAccount->getRollup(m_context)),
+        m_nextId(std::numeric_limits<std::uint32_t>::max()),
+        m_added({}),
+        m_removed({}),
+        m_history({})
+    {
+        refreshHistory();
+    }
+
+    Simulation::~Simulation()
+    {
+        clearHistory();
+
+        for (Purchase* purchase : m_added)
+        {
+            delete purchase;
+        }
+    }
+
+    std::uint32_t Simulation::addPurchase(
+        const QString& inName,
+        const QString& inDescription,
+        const QString& inDate,
+        const QString& inType,
+        const QString& inValue,
+        const QString& inInstallments
+    )
+    {
+        if (m_context.viewerId < 0)
+        {
+            return 0;
+        }
+
+        Purchase* purchase = new Purchase();
+        purchase->setId(          m_nextId--);
+        purchase->setUserId(      m_context.viewerId);
+        purchase->setAccountId(   m_account->getId());
+        purchase->setName(        inName);
+        purchase->setDescription( inDescription);
+        purchase->setDate(        QDate::fromString(inDate, "dd/MM/yyyy"));
+        purchase->setType(        Purchase::getTypeValue(inType));
+        purchase->setValue(       inValue.toFloat());
+        purchase->setInstallments(inInstallments.toInt());
+
+        m_added.push_back(purchase);
+
+        m_rollup.add(purchase);
+        m_usedLimit += m_account->getLimitUsage(m_context, purchase);
+
+        refreshHistory();
+
+        return purchase->getId();
+    }
+
+    void Simulation::removePurchase(std::uint32_t inId)
+    {
+        auto added = std::find_if(
+            m_added.begin(),
+            m_added.end(),
+            [inId](Purchase* _) { return _->getId() == inId; }
+        );
+
+        if (added != m_added.end())
+        {
+            Purchase* purchase = *added;
+
+            m_rollup.remove(purchase);
+            m_usedLimit -= m_account->getLimitUsage(m_context, purchase);
+
+            m_added.erase(added);
+
+            delete purchase;
+
+            refreshHistory();
+
+            return;
+        }
+
+        Purchase* purchase = getBasePurchase(inId);
+
+        if (purchase == nullptr || !m_removed.insert(inId).second)
+        {
+            return;
+        }
+
+        m_rollup.remove(purchase);
+        m_usedLimit -= m_account->getLimitUsage(m_context, purchase);
+
+        refreshHistory();
+    }
+
+    void Simulation::restorePurchase(std::uint32_t inId)
+    {
+        Purchase* purchase = getBasePurchase(inId);
+
+        if (purchase == nullptr || m_removed.erase(inId) == 0)
+        {
+            return;
+        }
+
+        m_rollup.add(purchase);
+        m_usedLimit += m_account->getLimitUsage(m_context, purchase);
+
+        refreshHistory();
+    }
+
+    bool Simulation::isRemoved(std::uint32_t inId)
+    {
+        return m_removed.find(inId) != m_removed.end();
+    }
+
+    bool Simulation::hasChanges()
+    {
+        return !m_added.isEmpty() || !m_removed.empty();
+    }
+
+    float Simulation::getUsedLimit()
+    {
+        return m_usedLimit;
+    }
+
+    float Simulation::getDueAmount()
+    {
+        return getDueAmount(m_context.asOf);
+    }
+
+    float Simulation::getDueAmount(const QDate& inDate)
+    {
+        Search::Rollup::Totals totals = m_rollup.get(
+            Search::Rollup::getStatementIndex(inDate, m_account->getClosingDay())
+        );
+
+        return totals.installments + totals.recurring;
+    }
+
+    void Simulation::commit()
+    {
+        QList<std::uint32_t> removed(m_removed.begin(), m_removed.end());
+
+        // The account takes ownership of the speculative purchases
+        QList<Purchase*> added = m_added;
+
+        m_added.clear();
+        m_removed.clear();
+
+        m_account->applyChanges(added, removed);
+
+        discard();
+    }
+
+    void Simulation::discard()
+    {
+        for (Purchase* purchase : m_added)
+        {
+            delete purchase;
+        }
+
+        m_added.clear();
+        m_removed.clear();
+
+        m_usedLimit = m_account->getUsedLimit(m_context);
+        m_rollup    = m_account->getRollup(m_context);
+
+        refreshHistory();
+    }
+
+    Purchase* Simulation::getBasePurchase(std::uint32_t inId)
+    {
+        return m_account->getPurchase(inId);
+    }
+
+    void Simulation::refreshHistory()
+    {
+        clearHistory();
+
+        int first = m_rollup.getFirstIndex();
+        int last  = std::max(
+            m_rollup.getLastIndex(),
+            Search::Rollup::getStatementIndex(m_context.asOf, m_account->getClosingDay())
+        );
+
+        if (first <= last)
+        {
+            std::vector<Search::Rollup::Totals> totals = m_rollup.get(first, last - first + 1);
+
+            for (int i = 0; i < (int) totals.size(); i++)
+            {
+                float dueAmount = totals[i].installments + totals[i].recurring;
+
+                // Same trimming as HistoryModel::refresh
+                bool isFirstEmpty = dueAmount == 0.0f && m_history.isEmpty();
+                bool isLastEmpty  = totals[i].installments == 0.0f && i == (int) totals.size() - 1;
+
+                if (isFirstEmpty || isLastEmpty)
+                {
+                    continue;
+                }
+
+                QDate month((first + i) / 12, ((first + i) % 12) + 1, 1);
+
+                Statement* statement = m_statements.create();
+                statement->setDate(QDate(
+                    month.year(),
+                    month.month(),
+                    m_account->getClosingDay(month)
+                ));
+                statement->setDueAmount(dueAmount);
+
+                m_history.push_back(statement);
+            }
+        }
+
+        emit onEdit();
+    }
+
+    void Simulation::clearHistory()
+    {
+        m_history.clear();
+        m_statements.beginGeneration();
+    }
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <unordered_set>
+
+#include <QtCore>
+#include <QtQml/qqmlregistration.h>
+
+#include "Purchase.hpp"
+#include "Statement.hpp"
+#include "Core/Context.hpp"
+#include "Search/Rollup.hpp"
+
+namespace Financy
+{
+    class Account;
+
+    // Copy-on-write overlay over an account's purchases, nothing is stored until it is committed
+    class Simulation : public QObject
+    {
+        Q_OBJECT
+        QML_ELEMENT
+        QML_UNCREATABLE("Internal use only")
+
+        Q_PROPERTY(
+            QList<Purchase*> purchases
+            MEMBER m_added
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            QList<Statement*> history
+            MEMBER m_history
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            float usedLimit
+            READ getUsedLimit
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            float dueAmount
+            READ getDueAmount
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            bool hasChanges
+            READ hasChanges
+            NOTIFY onEdit
+        )
+
+    public:
+        Simulation(Account* inAccount, QObject* parent = nullptr);
+        ~Simulation();
+
+    signals:
+        void onEdit();
+
+    public slots:
+        // Returns the speculative id, counted down from the top of the id range
+        std::uint32_t addPurchase(
+            const QString& inName,
+            const QString& inDescription,
+            const QString& inDate,
+            const QString& inType,
+            const QString& inValue,
+            const QString& inInstallments
+        );
+        void removePurchase(std::uint32_t inId);
+        void restorePurchase(std::uint32_t inId);
+
+        bool isRemoved(std::uint32_t inId);
+        bool hasChanges();
+
+        float getUsedLimit();
+        float getDueAmount();
+        float getDueAmount(const QDate& inDate);
+
+        void commit();
+        void discard();
+
+    private:
+        Purchase* getBasePurchase(std::uint32_t inId);
+
+        void refreshHistory();
+        void clearHistory();
+
+    private:
+        Account* m_account;
+
+        // Fixed when the simulation starts, so base values don't have to be recomputed
+        Context m_context;
+        float m_usedLimit;
+        Search::Rollup m_rollup;
+
+        std::uint32_t m_nextId;
+
+        QList<Purchase*> m_added;
+        std::unordered_set<std::uint32_t> m_removed;
+
+        QList<Statement*> m_history;
+        StatementArena m_statements;
+    };
+}
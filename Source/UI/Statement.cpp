@@ -1,5 +1,7 @@
 #include "Statement.hpp"
 
+#include <QQmlEngine>
+
 namespace Financy
 {
     Statement::Statement()
@@ -73,4 +75,25 @@ namespace Financy
     {
         return m_dueAmount;
     }
+
+    void StatementArena::beginGeneration()
+    {
+        m_previous.swap(m_current);
+        m_current.clear();
+    }
+
+    Statement* StatementArena::create()
+    {
+        Statement* result = &m_current.emplace_back();
+
+        QQmlEngine::setObjectOwnership(result, QQmlEngine::CppOwnership);
+
+        return result;
+    }
+
+    void StatementArena::clear()
+    {
+        m_current.clear();
+        m_previous.clear();
+    }
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <deque>
+
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 
 #include "Purchase.hpp"
 
@@ -9,6 +12,7 @@ namespace Financy
     class Statement : public QObject
     {
         Q_OBJECT
+        QML_ANONYMOUS
 
         Q_PROPERTY(
             QDate date
@@ -64,4 +68,30 @@ namespace Financy
         QList<Purchase*> m_subscriptions;
         float m_dueAmount;
     };
+
+    // Statements handed to QML, owned by whoever builds them and freed a whole generation at a time.
+    // The generation before the current one stays alive since QML may still show it while it is replaced
+    class StatementArena
+    {
+    public:
+        StatementArena() = default;
+        ~StatementArena() = default;
+
+        StatementArena(const StatementArena&) = delete;
+        StatementArena& operator=(const StatementArena&) = delete;
+
+    public:
+        // Frees the generation before the current one, the current one becomes the previous
+        void beginGeneration();
+
+        // Lives until two generations later, never collected by the QML engine
+        Statement* create();
+
+        void clear();
+
+    private:
+        // A deque never moves what it holds, the pointers handed out stay valid
+        std::deque<Statement> m_current;
+        std::deque<Statement> m_previous;
+    };
 }
\ No newline at end of file
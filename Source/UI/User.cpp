@@ -3,24 +3,21 @@
 #include <iostream>
 #include <fstream>
 
-#include <opencv2/core.hpp>
-#include <opencv2/imgcodecs.hpp>
-#include <opencv2/highgui.hpp>
-
-#include <cvmatandqimage.h>
-
-#include <base64.hpp>
-
 #include "Base.hpp"
 #include "Internal.hpp"
 #include "Core/FileSystem.hpp"
 #include "Core/Helper.hpp"
+#include "Storage/PictureStore.hpp"
+#include "Storage/Writer.hpp"
+#include "UI/AvatarProvider.hpp"
 
 namespace Financy
 {
     User::User()
         : m_fetchedAccounts(false),
+        m_didMigratePicture(false),
         m_id(0),
+        m_pictureRevision(0),
         m_firstName(""),
         m_lastName(""),
         m_picture(""),
@@ -60,6 +57,14 @@ namespace Financy
                 QString::fromStdString((std::string) inData.at("picture")) :
                 ""
         );
+
+        // Pictures used to be stored inline as base64 data URLs
+        if (Storage::Pictures::isDataUrl(m_picture))
+        {
+            setPicture(Storage::Pictures::storeDataUrl(m_picture));
+
+            m_didMigratePicture = true;
+        }
         setPrimaryColor(
             inData.find("primaryColor") != inData.end() ?
                 QString::fromStdString((std::string) inData.at("primaryColor")) :
@@ -85,46 +90,107 @@ namespace Financy
         };
     }
 
+    void User::write(Storage::Writer& outWriter)
+    {
+        outWriter.beginObject();
+        outWriter.key("id").value(            m_id);
+        outWriter.key("firstName").value(     m_firstName);
+        outWriter.key("lastName").value(      m_lastName);
+        outWriter.key("income").value(        m_income);
+        outWriter.key("picture").value(       m_picture);
+        outWriter.key("primaryColor").value(  m_primaryColor);
+        outWriter.key("secondaryColor").value(m_secondaryColor);
+        outWriter.endObject();
+    }
+
+    void User::fromData(const UserData& inData)
+    {
+        setId(            inData.id);
+        setFirstName(     inData.firstName);
+        setLastName(      inData.lastName);
+        setIncome(        inData.income);
+        setPicture(       inData.picture);
+        setPrimaryColor(  inData.primaryColor);
+        setSecondaryColor(inData.secondaryColor);
+    }
+
+    UserData User::toData()
+    {
+        UserData result;
+        result.id             = m_id;
+        result.firstName      = m_firstName;
+        result.lastName       = m_lastName;
+        result.income         = m_income;
+        result.picture        = m_picture;
+        result.primaryColor   = m_primaryColor;
+        result.secondaryColor = m_secondaryColor;
+
+        return result;
+    }
+
+    std::size_t UserData::getSize() const
+    {
+        return sizeof(UserData) + (firstName.size() + lastName.size() + picture.size()) * sizeof(QChar);
+    }
+
+    bool UserData::operator==(const UserData& inOther) const
+    {
+        return id == inOther.id &&
+            firstName == inOther.firstName &&
+            lastName == inOther.lastName &&
+            income == inOther.income &&
+            picture == inOther.picture &&
+            primaryColor == inOther.primaryColor &&
+            secondaryColor == inOther.secondaryColor;
+    }
+
     QString User::getFullName()
     {
         return m_firstName + " " + m_lastName;
     }
 
-    QVariantMap User::getExpenseMap()
+    QString User::getAvatar()
     {
-        return getExpenseMap(-1);
+        return getAvatar(Storage::Pictures::THUMBNAIL_SIZE);
     }
 
-    QVariantMap User::getExpenseMap(int inUserId)
+    QString User::getAvatar(int inSize)
     {
-        QDate now = QDate::currentDate();
+        if (m_picture.isEmpty())
+        {
+            return "";
+        }
 
-        QMap<QString, float> map;
+        return AvatarProvider::getUrl(
+            m_id,
+            (std::uint32_t) std::max(inSize, 1),
+            m_pictureRevision
+        );
+    }
 
-        for (Account* account : m_accounts)
-        {
-            if (account->getType() != Account::Type::Expense)
-            {
-                continue;
-            }
+    QVariantMap User::getExpenseMap()
+    {
+        return getExpenseMap(-1);
+    }
 
-            for (Purchase* purchase : account->getPurchases(now))
-            {
-                if (inUserId >= 0 && purchase->getUserId() != inUserId)
-                {
-                    continue;
-                }
+    QVariantMap User::getExpenseMap(int inUserId)
+    {
+        return getExpenseMap(Internal::getContext(), inUserId);
+    }
 
-                QString type = purchase->getTypeName();
+    QVariantMap User::getExpenseMap(const Context& inContext, int inUserId)
+    {
+        Search::Query query;
+        query.statementDate = inContext.asOf;
+        query.userId        = inUserId;
 
-                if (!map.contains(type))
-                {
-                    map.insert(type, 0);
-                }
+        QMap<QString, float> map;
 
-                map[type] += purchase->getInstallmentValue();
-            }
-        }
+        forEachPurchase(
+            inContext,
+            query,
+            [&map](Purchase* inPurchase) { map[inPurchase->getTypeName()] += inPurchase->getInstallmentValue(); }
+        );
 
         QVariantMap result;
 
@@ -145,12 +211,17 @@ namespace Financy
     }
 
     float User::getDueAmount(int inUserId)
+    {
+        return getDueAmount(Internal::getContext(), inUserId);
+    }
+
+    float User::getDueAmount(const Context& inContext, int inUserId)
     {
         float result = 0;
 
         for (Account* expenseAccount : getAccounts(Account::Type::Expense))
         {
-            result += expenseAccount->getDueAmount(inUserId);
+            result += expenseAccount->getDueAmount(inContext, inUserId);
         }
 
         return result;
@@ -163,7 +234,12 @@ namespace Financy
 
     float User::getSavedAmount(int inUserId)
     {
-        return m_income - getDueAmount(inUserId);
+        return getSavedAmount(Internal::getContext(), inUserId);
+    }
+
+    float User::getSavedAmount(const Context& inContext, int inUserId)
+    {
+        return m_income - getDueAmount(inContext, inUserId);
     }
 
     uint32_t User::getId()
@@ -235,7 +311,24 @@ namespace Financy
 
     void User::setPicture(const QString& inPicture)
     {
+        if (m_picture.compare(inPicture) != 0)
+        {
+            m_pictureRevision++;
+        }
+
         m_picture = inPicture;
+
+        AvatarProvider::setPicture(m_id, m_picture);
+    }
+
+    QString User::getPictureUrl()
+    {
+        return Storage::Pictures::getThumbnailUrl(m_picture);
+    }
+
+    bool User::didMigratePicture()
+    {
+        return m_didMigratePicture;
     }
 
     QColor User::getPrimaryColor()
@@ -296,6 +389,28 @@ namespace Financy
         return result;
     }
 
+    void User::forEachPurchase(const Search::Query& inQuery, const std::function<void(Purchase*)>& inCallback)
+    {
+        forEachPurchase(Internal::getContext(), inQuery, inCallback);
+    }
+
+    void User::forEachPurchase(
+        const Context& inContext,
+        const Search::Query& inQuery,
+        const std::function<void(Purchase*)>& inCallback
+    )
+    {
+        for (Account* account : getAccounts(Account::Type::Expense))
+        {
+            if (!Search::hasAccount(inQuery, account->getId()))
+            {
+                continue;
+            }
+
+            account->forEachPurchase(inContext, inQuery, inCallback);
+        }
+    }
+
     void User::setAccounts(const QList<Account*>& inAccounts)
     {
         m_accounts = inAccounts;
@@ -332,7 +447,7 @@ namespace Financy
             );
         }
 
-        if (m_picture.compare(inPicture.toString()) != 0)
+        if (getPictureUrl().compare(inPicture.toString()) != 0)
         {
             QString picture = formatPicture(inPicture);
 
@@ -341,7 +456,10 @@ namespace Financy
                 return;
             }
 
-            m_picture = picture;
+            setPicture(picture);
+
+            // The hash may not change when the same file is picked again, drop the decoded copies anyway
+            AvatarProvider::invalidate(m_id);
         }
 
         if (m_primaryColor.name().compare(inPrimaryColor.name()) != 0)
@@ -360,7 +478,8 @@ namespace Financy
     void User::remove()
     {
         removeAccounts();
-        removeFromFile();
+
+        AvatarProvider::setPicture(m_id, "");
     }
 
     void User::login()
@@ -454,32 +573,7 @@ namespace Financy
             return "";
         }
 
-        #ifdef OS_WINDOWS
-            std::vector<std::string> splittedUrl = Helper::splitString(
-                inUrl.toString().toStdString(),
-                "file:///"
-            );
-        #else
-            std::vector<std::string> splittedUrl = Helper::splitString(
-                inUrl.toString().toStdString(),
-                "file://"
-            );
-        #endif
-
-        std::string filePath = splittedUrl[splittedUrl.size() - 1];
-        std::vector<std::string> splittedFilepath = Helper::splitString(
-            filePath,
-            "."
-        );
-
-        std::string fileExtension = splittedFilepath[splittedFilepath.size() - 1];
-
-        std::vector<char> raw = FileSystem::readFile(filePath);
-        std::string sRaw(raw.begin(), raw.end());
-
-        return QString::fromLatin1(
-            "data:image/" + fileExtension + ";base64," + base64::to_base64(sRaw)
-        );
+        return Storage::Pictures::storeFile(inUrl.toLocalFile().toStdString());
     }
 
     void User::sortAccounts()
@@ -491,49 +585,6 @@ namespace Financy
         );
     }
 
-    void User::removeFromFile()
-    {
-        // Remove from file
-        if (!FileSystem::doesFileExist(USER_FILE_NAME))
-        {
-            return;
-        }
-
-        std::ifstream file(USER_FILE_NAME);
-
-        nlohmann::json storedUsers = nlohmann::json::parse(file);
-
-        if (storedUsers.size() < 0 || !storedUsers.is_array())
-        {
-            return;
-        }
-
-        std::uint32_t index  = 0;
-        std::size_t lastSize = storedUsers.size();
-
-        for (auto& it : storedUsers.items())
-        {
-            if ((std::uint32_t) it.value().at("id") != m_id)
-            {
-                index++;
-
-                continue;
-            }
-
-            storedUsers.erase(index);
-
-            break;
-        }
-
-        if (lastSize == storedUsers.size())
-        {
-            return;
-        }
-
-        std::ofstream stream(USER_FILE_NAME);
-        stream << std::setw(4) << storedUsers << std::endl;
-    }
-
     void User::removeAccounts()
     {
         m_accounts.clear();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QtCore>
+#include <QtQml/qqmlregistration.h>
 #include <QColor>
 #include <QImage>
 
@@ -10,9 +11,18 @@
 
 namespace Financy
 {
+    struct UserData;
+
+    namespace Storage
+    {
+        class Writer;
+    }
+
     class User : public QObject
     {
         Q_OBJECT
+        QML_ELEMENT
+        QML_UNCREATABLE("Internal use only")
 
         // Data
         Q_PROPERTY(
@@ -39,7 +49,12 @@ namespace Financy
         // Looks
         Q_PROPERTY(
             QString picture
-            MEMBER m_picture
+            READ getPictureUrl
+            NOTIFY onEdit
+        )
+        Q_PROPERTY(
+            QString avatar
+            READ getAvatar
             NOTIFY onEdit
         )
         Q_PROPERTY(
@@ -82,6 +97,9 @@ namespace Financy
     public slots:
         QString getFullName();
 
+        QString getAvatar();
+        QString getAvatar(int inSize);
+
         QVariantMap getExpenseMap();
         QVariantMap getExpenseMap(int inUserId);
 
@@ -91,9 +109,19 @@ namespace Financy
         float getSavedAmount();
         float getSavedAmount(int inUserId);
 
+    public:
+        QVariantMap getExpenseMap(const Context& inContext, int inUserId = -1);
+        float getDueAmount(const Context& inContext, int inUserId = -1);
+        float getSavedAmount(const Context& inContext, int inUserId = -1);
+
     public:
         void fromJSON(const nlohmann::json& inData);
         nlohmann::ordered_json toJSON();
+        void write(Storage::Writer& outWriter);
+
+        // Fields only, accounts are copied separately
+        void fromData(const UserData& inData);
+        UserData toData();
 
     public:
         uint32_t getId();
@@ -109,9 +137,12 @@ namespace Financy
         void setIncome(float inIncome);
 
         QString getPicture();
+        QString getPictureUrl();
         void setPicture(const QUrl& inUrl);
         void setPicture(const QString& inPicture);
 
+        bool didMigratePicture();
+
         QColor getPrimaryColor();
         void setPrimaryColor(const QColor& inColor);
 
@@ -124,6 +155,14 @@ namespace Financy
         QList<Account*> getAccounts(Account::Type inType);
         void setAccounts(const QList<Account*>& inAccounts);
 
+        // Runs the query over the user's expense accounts
+        void forEachPurchase(const Search::Query& inQuery, const std::function<void(Purchase*)>& inCallback);
+        void forEachPurchase(
+            const Context& inContext,
+            const Search::Query& inQuery,
+            const std::function<void(Purchase*)>& inCallback
+        );
+
         void edit(
             const QString& inFirstName,
             const QString& inLastName,
@@ -148,22 +187,41 @@ namespace Financy
 
         void sortAccounts();
 
-        void removeFromFile();
         void removeAccounts();
 
     private:
         bool m_fetchedAccounts;
+        bool m_didMigratePicture;
 
         uint32_t m_id;
+        uint32_t m_pictureRevision;
 
         QString m_firstName;
         QString m_lastName;
         float m_income;
-        QString m_picture; // Base64
+        QString m_picture; // Picture store hash
 
         QColor m_primaryColor;
         QColor m_secondaryColor;
 
         QList<Account*> m_accounts;
     };
+
+    struct UserData
+    {
+        std::uint32_t id = 0;
+
+        QString firstName;
+        QString lastName;
+        float income = 0.0f;
+        QString picture;
+
+        QColor primaryColor;
+        QColor secondaryColor;
+
+        // Approximate bytes held, strings included
+        std::size_t getSize() const;
+
+        bool operator==(const UserData& inOther) const;
+    };
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 import QtQuick
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -10,8 +13,8 @@ Components.SquircleButton {
 
     property url picture: "qrc:/Icons/Profile.svg"
 
-    property string primaryColor:   internal.colors.dark
-    property string secondaryColor: internal.colors.foreground
+    property string primaryColor:   Internal.colors.dark
+    property string secondaryColor: Internal.colors.foreground
 
     property real contentWidth: parent.width
 
@@ -6,6 +6,8 @@
 import QtQuick 2.0
 import QtQml 2.2
 
+import Financy.Types 1.0
+
 Item {
     id: root
 
@@ -19,19 +21,14 @@ Item {
     property bool isPie:             false         
     property bool showBackground:    false
     property real lineWidth:         20        
-    property string colorCircle:     internal.colors.background
-    property string colorBackground: internal.colors.foreground
+    property string colorCircle:     Internal.colors.background
+    property string colorBackground: Internal.colors.foreground
 
     property alias beginAnimation: animationArcBegin.enabled
     property alias endAnimation:   animationArcEnd.enabled
 
     property int animationDuration: 200
 
-    onArcBeginChanged:        canvas.requestPaint()
-    onArcEndChanged:          canvas.requestPaint()
-    onColorCircleChanged:     canvas.requestPaint()
-    onColorBackgroundChanged: canvas.requestPaint()
-
     Behavior on arcBegin {
        id: animationArcBegin
        enabled: true
@@ -50,63 +47,17 @@ Item {
        }
     }
 
-    Canvas {
-        id:           canvas
+    Arc {
+        id:           arc
         anchors.fill: parent
-        rotation:     -90 + parent.arcOffset
-        antialiasing: true
-
-        onPaint: function() {
-            const ctx   = getContext("2d");
-            const x     = width / 2;
-            const y     = height / 2;
-            const start = Math.PI * (Math.min(Math.max(parent.arcBegin, 0), 360) / 180);
-            const end   = Math.PI * (Math.min(Math.max(parent.arcEnd,   0), 360) / 180);
-
-            ctx.reset();
-
-            if (root.isPie) {
-                if (root.showBackground) {
-                    ctx.beginPath();
-
-                    ctx.fillStyle = root.colorBackground;
-
-                    ctx.moveTo(x, y);
-                    ctx.arc(x, y, width / 2, 0, Math.PI * 2, false);
-                    ctx.lineTo(x, y);
-                    ctx.fill();
-                }
-
-                ctx.beginPath();
-
-                ctx.fillStyle = root.colorCircle;
-
-                ctx.moveTo(x, y);
-                ctx.arc(x, y, width / 2, start, end, false);
-                ctx.lineTo(x, y);
-                ctx.fill();
-            } else {
-                if (root.showBackground) {
-                    ctx.beginPath();
-
-                    ctx.arc(x, y, (width / 2) - (parent.lineWidth / 2), 0, Math.PI * 2, false);
-
-                    ctx.lineWidth   = root.lineWidth * 0.6;
-                    ctx.strokeStyle = root.colorBackground;
-
-                    ctx.stroke();
-                }
-
-                ctx.beginPath();
-
-                ctx.arc(x, y, (width / 2) - (parent.lineWidth / 2), start, end, false);
-
-                ctx.lineWidth   = root.lineWidth;
-                ctx.strokeStyle = root.colorCircle;
-                ctx.lineCap     = "round";
 
-                ctx.stroke();
-            }
-        }
+        arcBegin:        root.arcBegin
+        arcEnd:          root.arcEnd
+        arcOffset:       root.arcOffset
+        isPie:           root.isPie
+        showBackground:  root.showBackground
+        lineWidth:       root.lineWidth
+        colorCircle:     root.colorCircle
+        colorBackground: root.colorBackground
     }
-}
\ No newline at end of file
+}
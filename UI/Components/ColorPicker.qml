@@ -1,6 +1,9 @@
 import QtQuick
 import Qt.labs.platform
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -24,7 +27,7 @@ Item {
 
     Components.Text {
         id:    _label
-        color: internal.colors.dark
+        color: Internal.colors.dark
         
         font.pointSize: 10
         font.weight:    Font.DemiBold
@@ -3,6 +3,9 @@ import QtQuick.Controls
 import QtQuick.Layouts
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -25,7 +28,7 @@ Components.Popup {
     }
 
     background: Components.SquircleContainer {
-        backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+        backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
         hasShadow:       true
     }
 
@@ -40,7 +43,7 @@ Components.Popup {
         Components.SquircleContainer {
             height: 30
 
-            backgroundColor: internal.colors.dark
+            backgroundColor: Internal.colors.dark
 
             Layout.fillWidth: true
 
@@ -55,7 +58,7 @@ Components.Popup {
                     date.setMonth(   _grid.month);
                     date.setFullYear(_grid.year);
 
-                    const newDate = internal.addMonths(date, -1);
+                    const newDate = Internal.addMonths(date, -1);
 
                     _grid.month = newDate.getMonth();
                     _grid.year  = newDate.getFullYear();
@@ -82,7 +85,7 @@ Components.Popup {
 
             Components.Text {
                 id:    _dateText
-                color: internal.colors.background
+                color: Internal.colors.background
                 text:  `${_grid.locale.monthName(_grid.month)} ${_grid.year}`
 
                 font.pointSize: 10
@@ -102,7 +105,7 @@ Components.Popup {
                     date.setMonth(   _grid.month);
                     date.setFullYear(_grid.year);
 
-                    const newDate = internal.addMonths(date, 1);
+                    const newDate = Internal.addMonths(date, 1);
 
                     _grid.month = newDate.getMonth();
                     _grid.year  = newDate.getFullYear();
@@ -139,7 +142,7 @@ Components.Popup {
                 required property string shortName
 
                 text:  shortName
-                color: internal.colors.dark
+                color: Internal.colors.dark
 
                 font.weight: Font.DemiBold
 
@@ -158,17 +161,17 @@ Components.Popup {
             delegate: Components.SquircleButton {
                 required property var model
 
-                property bool isSelected: internal.isSameDate(model.date, _date.selectedDate)
+                property bool isSelected: Internal.isSameDate(model.date, _date.selectedDate)
 
                 width:  _gridRoot.width * 0.14
                 height: _gridRoot.width * 0.14
 
                 isDisabled:           model.month !== _grid.month
                 disableWillOverwrite: false
-                backgroundColor:      isSelected ? internal.colors.light : "transparent"
+                backgroundColor:      isSelected ? Internal.colors.light : "transparent"
 
                 Components.Text {
-                    color:   internal.colors.dark
+                    color:   Internal.colors.dark
                     opacity: model.month === _grid.month ? 1 : 0.25
                     text:    model.day
 
@@ -1,6 +1,9 @@
 import QtQuick
 import QtQuick.Controls.Basic
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -11,7 +14,7 @@ Item {
     property real itemHeight: 40
     property real radius:     Math.min((itemHeight * 0.25), 9)
 
-    property string backgroundColor: internal.colors.foreground
+    property string backgroundColor: Internal.colors.foreground
 
     property alias model: _control.model
     property alias label: _label.text
@@ -75,14 +78,14 @@ Item {
 
             contentItem: Components.Text {
                 text:              _root.getOptionDisplay(item, index)
-                color:             _delegate.hovered ? internal.colors.background : internal.colors.dark
+                color:             _delegate.hovered ? Internal.colors.background : Internal.colors.dark
                 font:              _control.font
                 verticalAlignment: Text.AlignVCenter
                 padding:           _root.textPadding
             }
 
             background: Components.SquircleButton {
-                backgroundColor: _delegate.hovered ? internal.colors.light : "transparent"
+                backgroundColor: _delegate.hovered ? Internal.colors.light : "transparent"
 
                 anchors.fill: _delegate
             }
@@ -117,7 +120,7 @@ Item {
 
                 context.closePath();
 
-                context.fillStyle = internal.colors.dark
+                context.fillStyle = Internal.colors.dark
 
                 context.fill();
             }
@@ -127,7 +130,7 @@ Item {
             padding:           _root.textPadding
             text:              !_control.model || _control.model.length === 0 ? "Select" : _root.getOptionDisplay(_control.model[_control.currentIndex], _control.currentIndex)
             font:              _control.font
-            color:             internal.colors.dark
+            color:             Internal.colors.dark
             elide:             Text.ElideRight
 
             anchors.top:       parent.top
@@ -143,7 +146,7 @@ Item {
 
             Components.Text {
                 id:     _label
-                color:  internal.colors.dark
+                color:  Internal.colors.dark
                 text:   "Label"
                 opacity: 0.77
 
@@ -174,7 +177,7 @@ Item {
             }
 
             background: Components.SquircleContainer {
-                backgroundColor:  internal.colors.foreground
+                backgroundColor:  Internal.colors.foreground
                 backgroundRadius: _root.radius
                 clip:             true
             }
@@ -1,6 +1,9 @@
 import QtQuick
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -129,7 +132,7 @@ Components.SquircleButton {
         id:              _chart
         size:            60
         colorCircle:     _title.color
-        colorBackground: internal.colors.foreground
+        colorBackground: Internal.colors.foreground
         arcBegin:        0
         arcEnd:          360 * _root._ultilization
         lineWidth:       6
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -96,9 +99,9 @@ ScrollView {
                         return;
                     }
 
-                    internal.select(_item.id);
+                    Internal.select(_item.id);
 
-                    stack.push("qrc:/Pages/UserAccountHome.qml");
+                    pages.push("qrc:/Pages/UserAccountHome.qml");
                 }
 
                 onHover: function(inMouseArea) {
@@ -109,6 +112,8 @@ ScrollView {
                     }
 
                     opacity = 0.7;
+
+                    pages.preload("qrc:/Pages/UserAccountHome.qml");
                 }
 
                 onLeave: function(inMouseArea) {
@@ -131,7 +136,7 @@ ScrollView {
 
                 backgroundTopLeftRadius:  0
                 backgroundTopRightRadius: 0
-                backgroundColor:          internal.colors.dark
+                backgroundColor:          Internal.colors.dark
 
                 anchors.top:              _account.bottom
                 anchors.topMargin:        -1
@@ -211,7 +216,7 @@ ScrollView {
                     Components.Text {
                         id:    _editText
                         text:  "Edit"
-                        color: internal.colors.background
+                        color: Internal.colors.background
 
                         font.weight: Font.DemiBold
 
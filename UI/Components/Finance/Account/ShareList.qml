@@ -9,8 +9,8 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Item {
-    readonly property var user: internal.selectedUser
-    readonly property var accounts: internal.getAccounts(Account.Expense).filter((_) => !_.isOwnedBy(user.id) && !_.isSharingWith(user.id))
+    readonly property var user: Internal.selectedUser
+    readonly property var accounts: Internal.getAccounts(Account.Expense).filter((_) => !_.isOwnedBy(user.id) && !_.isSharingWith(user.id))
 
     property alias topPadding:    _scroll.topPadding
     property alias bottomPadding: _scroll.bottomPadding
@@ -21,7 +21,7 @@ Item {
 
     Components.Text {
         text:    "No expense accounts available"
-        color:   Qt.darker(internal.colors.foreground, 1.1)
+        color:   Qt.darker(Internal.colors.foreground, 1.1)
         visible: _root.accounts.length == 0
 
         font.weight:    Font.Bold
@@ -49,7 +49,7 @@ Item {
 
             delegate: Item {
                 readonly property var _item:  _list.model[index]
-                readonly property var _owner: internal.getUser(_item.userId)
+                readonly property var _owner: Internal.getUser(_item.userId)
 
                 height: 100
                 width:  _list.width * 0.95
@@ -65,10 +65,10 @@ Item {
                     Components.RoundImage {
                         id: _picture
 
-                        imageSource: _owner.picture ?? ""
+                        imageSource: _owner.avatar ?? ""
                         imageWidth:  parent.height * 0.5
                         imageHeight: parent.height * 0.5
-                        imageColor:  internal.colors.foreground
+                        imageColor:  Internal.colors.foreground
                         hasColor:    imageSource == ""
 
                         anchors.top:              parent.top
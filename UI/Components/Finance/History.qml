@@ -2,6 +2,9 @@ import QtCharts
 import QtQuick
 import QtQuick.Controls.Basic
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -9,7 +12,7 @@ Item {
     id: _root
 
     // Input
-    property var history: []
+    property var model: null
 
     property var onSelectedHistoryUpdate
 
@@ -17,9 +20,6 @@ Item {
     property var selectedHistory: undefined
     property int selectedIndex:   0
 
-    // Vars
-    property var _now: new Date()
-
     readonly property var _xAxis: ValueAxis {
         labelsVisible: false
         gridVisible:   false
@@ -29,49 +29,61 @@ Item {
         labelsVisible: false
         gridVisible:   false
         lineVisible:   false
+
+        min: 0
+        max: 1
     }
 
     property var _historyLine
     property var _historyScatter
 
-    function refresh(inHistory) {
-        _root._createChart(inHistory);
+    // Bumped whenever points or axes move, positions bound to the chart depend on it
+    property int _layout: 0
 
-        _root.history = inHistory;
+    function refresh(inModel) {
+        _root.model = inModel ?? null;
+
+        _root._reset();
+    }
 
-        if (_root.history.length <= 0) {
+    function select(index) {
+        if (!_root.model || _root.model.count <= 0) {
             return;
         }
-    
-        select(0);
-
-        let x = (_chart.width / _root.history.length) / (_chart.width * 2);
-        let y = 0;
-
-        const sortedHistory = _root.history.slice();
-        const maxValue      = sortedHistory.sort((a, b) => b.dueAmount - a.dueAmount)[0].dueAmount;
 
-        _root.history.forEach((statement, index) => {
-            y = statement.dueAmount / (maxValue * 1.45);
-            y += 0.08;
+        // Only a window of the timeline is loaded, reaching one of its ends moves it a page. The model
+        // reports how far the loaded rows moved, the points follow through its row signals
+        if (index <= 0 && _root.model.hasPrevious()) {
+            _root._select(index + _root.model.fetchPrevious());
 
-            _historyLine.append(   x, y);
-            _historyScatter.append(x, y);
+            return;
+        }
 
-            x += (_chart.width / _root.history.length) / _chart.width;
-        });
+        if (index >= _root.model.count - 1 && _root.model.hasNext()) {
+            _root._select(index + _root.model.fetchNext());
 
-        _months.model = _root.history.length;
+            return;
+        }
 
-        this._centerOnCurrentStatement();
+        _root._select(index);
     }
 
-    function select(index) {
-        if (_root.history.length <= 0) {
+    function _reset() {
+        _root._createChart();
+
+        if (!_root.model || _root.model.count <= 0) {
             return;
         }
 
-        _root.selectedHistory = _root.history[index];
+        _root._insertPoints(0, _root.model.count - 1);
+
+        const index = _root.model.currentRow;
+
+        _root._select(index < 0 || index >= _root.model.count ? _root.model.count - 1 : index);
+    }
+
+    function _select(index) {
+        _root.selectedHistory = _root.model.get(index);
         _root.selectedIndex   = index;
 
         _chart.centerOn(
@@ -88,12 +100,53 @@ Item {
         _root.onSelectedHistoryUpdate();
     }
 
-    function _createChart(inHistory) {
-        _months.model         = 0;
+    // Statements are placed by month, so points keep their x however the window moves
+    function _getPoint(row) {
+        const statement = _root.model.get(row);
+        const maxValue  = _root.model.maxDue;
+
+        return Qt.point(
+            (statement.date.getFullYear() * 12) + statement.date.getMonth(),
+            (maxValue > 0 ? statement.dueAmount / (maxValue * 1.45) : 0) + 0.08
+        );
+    }
+
+    function _insertPoints(first, last) {
+        for (let row = first; row <= last; row++) {
+            const point = _root._getPoint(row);
+
+            _historyLine.insert(   row, point.x, point.y);
+            _historyScatter.insert(row, point.x, point.y);
+        }
+
+        _root._updateAxes();
+    }
+
+    function _removePoints(first, last) {
+        _historyLine.removePoints(   first, last - first + 1);
+        _historyScatter.removePoints(first, last - first + 1);
+
+        _root._updateAxes();
+    }
+
+    function _updateAxes() {
+        const count = _historyScatter.count;
+
+        _chart.width = 200 * count;
+
+        if (count > 0) {
+            _root._xAxis.min = _historyScatter.at(0).x - 0.5;
+            _root._xAxis.max = _historyScatter.at(count - 1).x + 0.5;
+        }
+
+        _root._layout++;
+    }
+
+    function _createChart() {
         _root.selectedHistory = undefined;
 
         _chart.removeAllSeries();
-        _chart.width = 200 * inHistory.length;
+        _chart.width = 0;
 
         // Line
         _historyLine = _chart.createSeries(
@@ -102,7 +155,7 @@ Item {
             _root._xAxis,
             _root._yAxis
         );
-        _historyLine.color     = internal.colors.foreground;
+        _historyLine.color     = Internal.colors.foreground;
         _historyLine.width     = 2;
         _historyLine.useOpenGL = true;
 
@@ -120,14 +173,20 @@ Item {
         _historyScatter.useOpenGL   = true;
     }
 
-    function _centerOnCurrentStatement() {
-        let currentIndex = _root.history.findIndex((statement) => statement.isCurrentStatement(_root._now));
+    Connections {
+        target: _root.model
+
+        function onRowsInserted(parent, first, last) {
+            _root._insertPoints(first, last);
+        }
 
-        if (currentIndex < 0) {
-            currentIndex = _root.history.length - 1;
+        function onRowsRemoved(parent, first, last) {
+            _root._removePoints(first, last);
         }
 
-        _root.select(currentIndex);
+        function onModelReset() {
+            _root._reset();
+        }
     }
   
     Item {
@@ -157,22 +216,28 @@ Item {
             }
 
             function centerOn(point) {
-                _chart.x = ((_chartScroll.width / 2) - point.x) - ((_chart.width / history.length) / (_chart.width * 2));
+                _chart.x = ((_chartScroll.width / 2) - point.x) - ((_chart.width / _historyScatter.count) / (_chart.width * 2));
             }
 
+            // Follows the model's row inserts and removals, only the delegates of new rows are created
             Repeater {
                 id:    _months
-                model: 0
+                model: _root.model
 
                 delegate: Item {
                     required property int index
+                    required property var date
+                    required property real dueAmount
+                    required property bool isFuture
 
-                    readonly property var _position: _chart.mapToPosition(_historyScatter.at(index), _historyScatter)
-                    readonly property var _data:     _root.history[index]
+                    // Delegates can come before their point, the layout bump places them once it is in
+                    readonly property var _position: _root._layout >= 0 && _historyScatter && index < _historyScatter.count ?
+                        _chart.mapToPosition(_historyScatter.at(index), _historyScatter) :
+                        Qt.point(0, 0)
 
-                    property bool _isSelected:   _root.selectedHistory ? _data.date.toString() === _root.selectedHistory.date.toString() : false
-                    property bool _isFuture:     _data.isFuture(_root._now)
-                    property bool _changedYears: index > 0 ? !_data.isSameYear(_root.history[index - 1].date) : true
+                    property bool _isSelected:   _root.selectedHistory ? date.toString() === _root.selectedHistory.date.toString() : false
+                    property bool _isFuture:     isFuture
+                    property bool _changedYears: index > 0 ? date.getFullYear() !== _root.model.get(index - 1).date.getFullYear() : true
 
                     x: _position.x
                     y: _position.y
@@ -186,9 +251,9 @@ Item {
                         width:        _historyScatter.markerSize
                         height:       _historyScatter.markerSize
                         radius:       _historyScatter.markerSize / 2
-                        color:        _isSelected ? internal.colors.light : _isFuture ? internal.colors.background : internal.colors.dark
+                        color:        _isSelected ? Internal.colors.light : _isFuture ? Internal.colors.background : Internal.colors.dark
                         border.width: _isFuture ? _isSelected ? 0 : _historyScatter.borderWidth : 0
-                        border.color: _isFuture ? internal.colors.foreground : "transparent"
+                        border.color: _isFuture ? Internal.colors.foreground : "transparent"
 
                         onClick: function() {
                             if (_isSelected) {
@@ -201,8 +266,8 @@ Item {
 
                     Components.Text {
                         id:    _dueAmount
-                        text:  _data.dueAmount.toFixed(2)
-                        color: internal.colors.dark
+                        text:  dueAmount.toFixed(2)
+                        color: Internal.colors.dark
 
                         font.pointSize: 12
                         font.weight:    Font.Bold
@@ -237,8 +302,8 @@ Item {
 
                     Components.Text {
                         id:    _text
-                        text:  internal.getLongMonth(_data.date)
-                        color: internal.colors.dark
+                        text:  Internal.getLongMonth(date)
+                        color: Internal.colors.dark
 
                         font.pointSize: 9
                         font.weight:    Font.DemiBold
@@ -262,8 +327,8 @@ Item {
 
                         Components.Text {
                             id:    _separatorText
-                            text:  _data.date.getFullYear()
-                            color: internal.colors.dark
+                            text:  date.getFullYear()
+                            color: Internal.colors.dark
 
                             font.pointSize: 12
                             font.weight:    Font.DemiBold
@@ -272,7 +337,7 @@ Item {
                         Rectangle {
                             width:  1
                             height: _chartScroll.height
-                            color: internal.colors.light
+                            color: Internal.colors.light
                             radius: 0.5
 
                             anchors.top:              _separatorText.bottom
@@ -9,8 +9,8 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Modal {
-    readonly property var user:    internal.selectedUser
-    readonly property var account: internal.selectedAccount
+    readonly property var user:    Internal.selectedUser
+    readonly property var account: Internal.selectedAccount
 
     property var onSubmit
 
@@ -25,19 +25,19 @@ Components.Modal {
         _type.clear();
 
         _datePicker.set(new Date());
-        _date.set(internal.getLongDate(_datePicker.selectedDate));
+        _date.set(Internal.getLongDate(_datePicker.selectedDate));
         _installments.set("1");
     }
 
     Components.SquircleContainer {
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+        backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
 
         anchors.fill: parent
 
         Components.Text {
             id:    _title
-            color: internal.colors.dark
+            color: Internal.colors.dark
             text:  "New Purchase"
 
             font.pointSize: 30
@@ -63,7 +63,7 @@ Components.Modal {
                 width: (parent.width * 0.5) - 5
 
                 label:       "Name"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 minLength:   1
                 maxLength:   50
                 inputHeight: 60
@@ -78,7 +78,7 @@ Components.Modal {
                 width:  _name.width
 
                 label:      "Description"
-                color:      internal.colors.dark
+                color:      Internal.colors.dark
                 minLength:  0
                 maxLength:  50
                 inputHeight: _name.inputHeight
@@ -104,14 +104,14 @@ Components.Modal {
                 width: (parent.width * 0.5) - 5
 
                 label:       "Installments"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
 
                 anchors.left: parent.left
 
                 validator: IntValidator {
-                    bottom: internal.getMinInstallmentCount()
-                    top:    internal.getMaxInstallmentCount()
+                    bottom: Internal.getMinInstallmentCount()
+                    top:    Internal.getMaxInstallmentCount()
                 }
 
                 KeyNavigation.tab: _value.input
@@ -122,7 +122,7 @@ Components.Modal {
                 width:  _installments.width
 
                 label:       "Total Value"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
 
                 anchors.right: parent.right
@@ -151,7 +151,7 @@ Components.Modal {
 
                 label:       "Date"
                 hint:        "dd/mm/yyyy"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
                 minLength:   "00/00/0000".length
 
@@ -188,7 +188,7 @@ Components.Modal {
                     ColorOverlay {
                         anchors.fill: _dateIcon
                         source:       _dateIcon
-                        color:        _date.isDisabled ? internal.colors.foreground : internal.colors.light
+                        color:        _date.isDisabled ? Internal.colors.foreground : Internal.colors.light
                         antialiasing: true
                     }
                 }
@@ -201,7 +201,7 @@ Components.Modal {
                     height: 228
 
                     onSelect: function(date) {
-                        _date.set(internal.getLongDate(date));
+                        _date.set(Internal.getLongDate(date));
                     }
                 }
             }
@@ -209,7 +209,7 @@ Components.Modal {
             Components.Dropdown {
                 id:    _type
                 label: "Type"
-                model: internal.getPurchaseTypes() ?? []
+                model: Internal.getPurchaseTypes() ?? []
 
                 itemWidth: (parent.width * 0.5) - 5
                 itemHeight: _value.inputHeight
@@ -223,7 +223,7 @@ Components.Modal {
             width:  parent.width * 0.45
             height: 60
 
-            backgroundColor: internal.colors.dark
+            backgroundColor: Internal.colors.dark
 
             isDisabled: _name.hasError || _description.hasError || _date.hasError || _value.hasError || _installments.hasError
 
@@ -257,7 +257,7 @@ Components.Modal {
 
             Components.Text {
                 text:  "Create"
-                color: _submitButton.isDisabled ? internal.colors.foreground : internal.colors.background
+                color: _submitButton.isDisabled ? Internal.colors.foreground : Internal.colors.background
 
                 font.weight:    Font.Bold
                 font.pointSize: 15
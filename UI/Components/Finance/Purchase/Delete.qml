@@ -1,6 +1,9 @@
 import QtQuick
 import QtQuick.Controls
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -16,14 +19,14 @@ Components.Modal {
         height: 180
 
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+        backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
 
         anchors.horizontalCenter: parent.horizontalCenter
         anchors.verticalCenter:   parent.verticalCenter
 
         Components.Text {
             id:    _title
-            color: internal.colors.dark
+            color: Internal.colors.dark
             text:  "You're about to delete " + (purchase?.name ?? "")
 
             font.pointSize: 15
@@ -36,7 +39,7 @@ Components.Modal {
 
         Components.Text {
             id:    _disclaimer
-            color: internal.colors.light
+            color: Internal.colors.light
             text:  "This action cannot be reversed"
 
             font.pointSize: 12
@@ -52,7 +55,7 @@ Components.Modal {
             width:  parent.width * 0.45
             height: 60
 
-            backgroundColor: internal.colors.dark
+            backgroundColor: Internal.colors.dark
 
             anchors.bottom:           parent.bottom
             anchors.bottomMargin:     25
@@ -70,7 +73,7 @@ Components.Modal {
 
             Components.Text {
                 text:  "Delete"
-                color: internal.colors.background
+                color: Internal.colors.background
 
                 font.weight:    Font.Bold
                 font.pointSize: 15
@@ -9,7 +9,7 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Modal {
-    readonly property var account: internal.selectedAccount
+    readonly property var account: Internal.selectedAccount
 
     property var purchase
     property var onSubmit
@@ -21,25 +21,25 @@ Components.Modal {
 
         _description.set(_root.purchase.description);
 
-        _date.set(      internal.getLongDate(_root.purchase.date));
+        _date.set(      Internal.getLongDate(_root.purchase.date));
         _datePicker.set(_root.purchase.date);
 
         _value.set(_root.purchase.value.toFixed(2));
 
         _installments.set(_root.purchase.installments);
 
-        _type.set(internal.getPurchaseTypeName(_root.purchase.type));
+        _type.set(Internal.getPurchaseTypeName(_root.purchase.type));
     }
 
     Components.SquircleContainer {
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+        backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
 
         anchors.fill: parent
 
         Components.Text {
             id:    _title
-            color: internal.colors.dark
+            color: Internal.colors.dark
             text:  "Edit " + _root.purchase?.name
 
             font.pointSize: 30
@@ -65,7 +65,7 @@ Components.Modal {
                 width: (parent.width * 0.5) - 5
 
                 label:       "Name"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 minLength:   1
                 maxLength:   50
                 inputHeight: 60
@@ -80,7 +80,7 @@ Components.Modal {
                 width:  _name.width
 
                 label:      "Description"
-                color:      internal.colors.dark
+                color:      Internal.colors.dark
                 minLength:  0
                 maxLength:  50
                 inputHeight: _name.inputHeight
@@ -106,14 +106,14 @@ Components.Modal {
                 width: (parent.width * 0.5) - 5
 
                 label:       "Installments"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
 
                 anchors.left: parent.left
 
                 validator: IntValidator {
-                    bottom: internal.getMinInstallmentCount()
-                    top:    internal.getMaxInstallmentCount()
+                    bottom: Internal.getMinInstallmentCount()
+                    top:    Internal.getMaxInstallmentCount()
                 }
 
                 KeyNavigation.tab: _value.input
@@ -124,7 +124,7 @@ Components.Modal {
                 width: _installments.width
 
                 label:       "Total Value"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
 
                 anchors.right: parent.right
@@ -154,7 +154,7 @@ Components.Modal {
 
                 label:       "Date"
                 hint:        "dd/mm/yyyy"
-                color:       internal.colors.dark
+                color:       Internal.colors.dark
                 inputHeight: _name.inputHeight
                 minLength:   "00/00/0000".length
 
@@ -191,7 +191,7 @@ Components.Modal {
                     ColorOverlay {
                         anchors.fill: _dateIcon
                         source:       _dateIcon
-                        color:        _date.isDisabled ? internal.colors.foreground : internal.colors.light
+                        color:        _date.isDisabled ? Internal.colors.foreground : Internal.colors.light
                         antialiasing: true
                     }
                 }
@@ -204,7 +204,7 @@ Components.Modal {
                     height: 228
 
                     onSelect: function(date) {
-                        _date.set(internal.getLongDate(date));
+                        _date.set(Internal.getLongDate(date));
                     }
                 }
             }
@@ -212,7 +212,7 @@ Components.Modal {
             Components.Dropdown {
                 id:    _type
                 label: "Type"
-                model: internal.getPurchaseTypes() ?? []
+                model: Internal.getPurchaseTypes() ?? []
 
                 itemWidth: (parent.width * 0.5) - 5
                 itemHeight: _value.inputHeight
@@ -226,7 +226,7 @@ Components.Modal {
             width:  parent.width * 0.45
             height: 60
 
-            backgroundColor: internal.colors.dark
+            backgroundColor: Internal.colors.dark
 
             isDisabled: _name.hasError || _description.hasError || _date.hasError || _value.hasError || _installments.hasError
 
@@ -261,7 +261,7 @@ Components.Modal {
 
             Components.Text {
                 text:  "Edit"
-                color: _submitButton.isDisabled ? internal.colors.foreground : internal.colors.background
+                color: _submitButton.isDisabled ? Internal.colors.foreground : Internal.colors.background
 
                 font.weight:    Font.Bold
                 font.pointSize: 15
@@ -12,8 +12,8 @@ Item {
     property var purchase
     property var statement
 
-    readonly property var user:    internal.selectedUser
-    readonly property var account: internal.selectedAccount
+    readonly property var user:    Internal.selectedUser
+    readonly property var account: Internal.selectedAccount
 
     readonly property bool hasDescription:    purchase.hasDescription()
     readonly property bool hasDifferentOwner: !purchase.isOwnedBy(user.id)
@@ -44,7 +44,7 @@ Item {
     }
 
     Rectangle {
-        color:   internal.colors.foreground
+        color:   Internal.colors.foreground
         width:   parent.width
         height:  1
         visible: index > 0
@@ -57,7 +57,7 @@ Item {
         height: 30
         width:  30
 
-        backgroundColor: internal.colors.dark
+        backgroundColor: Internal.colors.dark
 
         anchors.top:            hasExtras ? _purchaseName.top : undefined
         anchors.left:           parent.left
@@ -80,7 +80,7 @@ Item {
         ColorOverlay {
             anchors.fill: _iconImage
             source:       _iconImage
-            color:        internal.colors.foreground
+            color:        Internal.colors.foreground
             antialiasing: true
         }
     }
@@ -88,7 +88,7 @@ Item {
     Components.Text {
         id:      _purchaseName
         text:    purchase.name + (purchase.isRecurring() ? "" : (" " + account.getPaidInstallments(purchase, statement.date) + "/" + purchase.installments))
-        color:   internal.colors.dark
+        color:   Internal.colors.dark
 
         font.pointSize: 9
         font.weight:    Font.Normal
@@ -106,7 +106,7 @@ Item {
         width:   _text.paintedWidth + 10
         visible: hasDescription
 
-        backgroundColor: Qt.lighter(internal.colors.dark, 2)
+        backgroundColor: Qt.lighter(Internal.colors.dark, 2)
 
         anchors.top:        _purchaseName.bottom
         anchors.left:       _purchaseName.anchors.left
@@ -116,7 +116,7 @@ Item {
         Components.Text {
             id:    _text
             text:  purchase.description
-            color: internal.colors.background
+            color: Internal.colors.background
 
             font.pointSize: 8
             font.weight:    Font.Bold
@@ -126,7 +126,7 @@ Item {
     }
 
     Components.SquircleContainer {
-        readonly property var owner: internal.getUser(purchase.userId)
+        readonly property var owner: Internal.getUser(purchase.userId)
 
         id:      _owner
         height:  _ownerText.paintedHeight + 2
@@ -205,7 +205,7 @@ Item {
             ColorOverlay {
                 anchors.fill: _leftButtonIcon
                 source:       _leftButtonIcon
-                color:        internal.colors.dark
+                color:        Internal.colors.dark
                 antialiasing: true
             }
 
@@ -224,7 +224,7 @@ Item {
 
                 background: Components.SquircleContainer {
                     hasShadow:       true
-                    backgroundColor: internal.colors.background
+                    backgroundColor: Internal.colors.background
                 }
 
                 Timer {
@@ -270,15 +270,15 @@ Item {
                         }
 
                         onHover: function() {
-                            _editButton.color         = internal.colors.dark;
-                            _editButtonIconFill.color = internal.colors.background;
-                            _editButtonText.color     = internal.colors.background;
+                            _editButton.color         = Internal.colors.dark;
+                            _editButtonIconFill.color = Internal.colors.background;
+                            _editButtonText.color     = Internal.colors.background;
                         }
 
                         onLeave: function() {
-                            _editButton.color         = internal.colors.background;
-                            _editButtonIconFill.color = internal.colors.dark;
-                            _editButtonText.color     = internal.colors.dark;
+                            _editButton.color         = Internal.colors.background;
+                            _editButtonIconFill.color = Internal.colors.dark;
+                            _editButtonText.color     = Internal.colors.dark;
                         }
 
                         Image {
@@ -298,14 +298,14 @@ Item {
                             id:           _editButtonIconFill
                             anchors.fill: _editButtonIcon
                             source:       _editButtonIcon
-                            color:        internal.colors.dark
+                            color:        Internal.colors.dark
                             antialiasing: true
                         }
 
                         Components.Text {
                             id:    _editButtonText
                             text:  "Edit"
-                            color: internal.colors.dark
+                            color: Internal.colors.dark
 
                             anchors.left:           _editButtonIcon.right
                             anchors.leftMargin:     5
@@ -332,15 +332,15 @@ Item {
                         }
 
                         onHover: function() {
-                            _cancelButton.color         = internal.colors.dark;
-                            _cancelButtonIconFill.color = internal.colors.background;
-                            _cancelButtonText.color     = internal.colors.background;
+                            _cancelButton.color         = Internal.colors.dark;
+                            _cancelButtonIconFill.color = Internal.colors.background;
+                            _cancelButtonText.color     = Internal.colors.background;
                         }
 
                         onLeave: function() {
-                            _cancelButton.color         = internal.colors.background;
-                            _cancelButtonIconFill.color = internal.colors.dark;
-                            _cancelButtonText.color     = internal.colors.dark;
+                            _cancelButton.color         = Internal.colors.background;
+                            _cancelButtonIconFill.color = Internal.colors.dark;
+                            _cancelButtonText.color     = Internal.colors.dark;
                         }
 
                         Image {
@@ -360,14 +360,14 @@ Item {
                             id:           _cancelButtonIconFill
                             anchors.fill: _cancelButtonIcon
                             source:       _cancelButtonIcon
-                            color:        internal.colors.dark
+                            color:        Internal.colors.dark
                             antialiasing: true
                         }
 
                         Components.Text {
                             id:    _cancelButtonText
                             text:  "Cancel"
-                            color: internal.colors.dark
+                            color: Internal.colors.dark
 
                             anchors.left:           _cancelButtonIcon.right
                             anchors.leftMargin:     5
@@ -394,15 +394,15 @@ Item {
                         }
 
                         onHover: function() {
-                            _deleteButton.color         = internal.colors.dark;
-                            _deleteButtonIconFill.color = internal.colors.background;
-                            _deleteButtonText.color     = internal.colors.background;
+                            _deleteButton.color         = Internal.colors.dark;
+                            _deleteButtonIconFill.color = Internal.colors.background;
+                            _deleteButtonText.color     = Internal.colors.background;
                         }
 
                         onLeave: function() {
-                            _deleteButton.color         = internal.colors.background;
-                            _deleteButtonIconFill.color = internal.colors.dark;
-                            _deleteButtonText.color     = internal.colors.dark;
+                            _deleteButton.color         = Internal.colors.background;
+                            _deleteButtonIconFill.color = Internal.colors.dark;
+                            _deleteButtonText.color     = Internal.colors.dark;
                         }
 
                         Image {
@@ -422,14 +422,14 @@ Item {
                             id:           _deleteButtonIconFill
                             anchors.fill: _deleteButtonIcon
                             source:       _deleteButtonIcon
-                            color:        internal.colors.dark
+                            color:        Internal.colors.dark
                             antialiasing: true
                         }
 
                         Components.Text {
                             id:    _deleteButtonText
                             text:  "Delete"
-                            color: internal.colors.dark
+                            color: Internal.colors.dark
 
                             anchors.left:           _deleteButtonIcon.right
                             anchors.leftMargin:     5
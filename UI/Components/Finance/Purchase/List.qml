@@ -9,7 +9,7 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.SquircleContainer {
-    readonly property var user: internal.selectedUser
+    readonly property var user: Internal.selectedUser
 
     property var statement
     property var purchases:     []
@@ -47,8 +47,8 @@ Components.SquircleContainer {
         _purchases.model            = 0;
         _subscriptionsContent.model = 0;
 
-        internal.clear(purchases,     true);
-        internal.clear(subscriptions, false);
+        Internal.clear(purchases,     true);
+        Internal.clear(subscriptions, false);
 
         purchases     = [];
         subscriptions = [];
@@ -84,7 +84,7 @@ Components.SquircleContainer {
                 width:  _scroll.width * 0.96
                 height: _purchaseHeader.height + _purchasesContent.height
 
-                backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+                backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
 
                 anchors.top:       _sibling ? _sibling.bottom : parent.top
                 anchors.topMargin: 20
@@ -98,7 +98,7 @@ Components.SquircleContainer {
                     width:  parent.width
                     height: statementTitleHeight
 
-                    backgroundColor:             internal.colors.dark
+                    backgroundColor:             Internal.colors.dark
                     backgroundBottomLeftRadius:  0
                     backgroundBottomRightRadius: 0
 
@@ -107,7 +107,7 @@ Components.SquircleContainer {
                     Components.Text {
                         id:    _headerDateTitle
                         text:  "Date"
-                        color: internal.colors.background
+                        color: Internal.colors.background
 
                         font.pointSize: 9
                         font.weight:    Font.Bold
@@ -118,8 +118,8 @@ Components.SquircleContainer {
                     }
 
                     Components.Text {
-                        text:  internal.getLongDate(_data.date)
-                        color: internal.colors.background
+                        text:  Internal.getLongDate(_data.date)
+                        color: Internal.colors.background
 
                         font.pointSize: 9
                         font.weight:    Font.Normal
@@ -132,7 +132,7 @@ Components.SquircleContainer {
                     Components.Text {
                         id:    _headerTotalTitle
                         text:  "Total"
-                        color: internal.colors.background
+                        color: Internal.colors.background
 
                         font.pointSize: 9
                         font.weight:    Font.Bold
@@ -145,7 +145,7 @@ Components.SquircleContainer {
                     Components.Text {
                         id:    _headerValueTitle
                         text:  _data.dueAmount.toFixed(2)
-                        color: internal.colors.background
+                        color: Internal.colors.background
 
                         font.pointSize: 9
                         font.weight:    Font.Normal
@@ -207,7 +207,7 @@ Components.SquircleContainer {
             height:  statementTitleHeight
             visible: (subscriptions ?? []).length > 0
 
-            backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+            backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
 
             anchors.top:       _purchases.bottom    
             anchors.topMargin: 20
@@ -217,7 +217,7 @@ Components.SquircleContainer {
                 width:  parent.width
                 height: statementTitleHeight
 
-                backgroundColor:             internal.colors.dark
+                backgroundColor:             Internal.colors.dark
                 backgroundBottomLeftRadius:  0
                 backgroundBottomRightRadius: 0
 
@@ -226,7 +226,7 @@ Components.SquircleContainer {
                 Components.Text {
                     id:    _headerTitle
                     text:  "Recurring"
-                    color: internal.colors.background
+                    color: Internal.colors.background
 
                     font.pointSize: 9
                     font.weight:    Font.Bold
@@ -239,7 +239,7 @@ Components.SquircleContainer {
                 Components.Text {
                     id:    _headerTotalTitle
                     text:  "Total"
-                    color: internal.colors.background
+                    color: Internal.colors.background
 
                     font.pointSize: 9
                     font.weight:    Font.Bold
@@ -251,8 +251,8 @@ Components.SquircleContainer {
 
                 Components.Text {
                     id:    _headerValueTitle
-                    text:  internal.getDueAmount(subscriptions ?? []).toFixed(2)
-                    color: internal.colors.background
+                    text:  Internal.getDueAmount(subscriptions ?? []).toFixed(2)
+                    color: Internal.colors.background
 
                     font.pointSize: 9
                     font.weight:    Font.Normal
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -32,7 +35,7 @@ Rectangle {
         visible: leftButtonIcon != ""
 
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+        backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
 
         anchors.right:          _centerButton.left
         anchors.rightMargin:    30
@@ -52,7 +55,7 @@ Rectangle {
         ColorOverlay {
             anchors.fill: _leftButtonIcon
             source:       _leftButtonIcon
-            color:        _leftButton.isDisabled ? internal.colors.foreground : internal.colors.light
+            color:        _leftButton.isDisabled ? Internal.colors.foreground : Internal.colors.light
             antialiasing: true
         }
     }
@@ -64,7 +67,7 @@ Rectangle {
         visible: centerButtonIcon != ""
 
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+        backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
 
         anchors.verticalCenter:   parent.verticalCenter
         anchors.horizontalCenter: parent.horizontalCenter
@@ -83,7 +86,7 @@ Rectangle {
         ColorOverlay {
             anchors.fill: _centerButtonIcon
             source:       _centerButtonIcon
-            color:        _centerButton.isDisabled ? internal.colors.foreground : internal.colors.light
+            color:        _centerButton.isDisabled ? Internal.colors.foreground : Internal.colors.light
             antialiasing: true
         }
     }
@@ -95,7 +98,7 @@ Rectangle {
         visible: rightButtonIcon != ""
 
         hasShadow:       true
-        backgroundColor: Qt.lighter(internal.colors.foreground, 1.1)
+        backgroundColor: Qt.lighter(Internal.colors.foreground, 1.1)
 
         anchors.left:           _centerButton.right
         anchors.leftMargin:     _leftButton.anchors.rightMargin
@@ -115,7 +118,7 @@ Rectangle {
         ColorOverlay {
             anchors.fill: _rightButtonIcon
             source:       _rightButtonIcon
-            color:        _rightButtonIcon.isDisabled ? internal.colors.foreground : internal.colors.light
+            color:        _rightButtonIcon.isDisabled ? Internal.colors.foreground : Internal.colors.light
             antialiasing: true
         }
     }
@@ -1,6 +1,9 @@
 import QtQuick
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -37,7 +40,7 @@ Rectangle {
 
             onLeave: function() {
                 color                  = "transparent";
-                closeIconOverlay.color = internal.colors.dark;
+                closeIconOverlay.color = Internal.colors.dark;
             }
 
             Image {
@@ -54,7 +57,7 @@ Rectangle {
                 id:           closeIconOverlay
                 anchors.fill: closeIcon
                 source:       closeIcon
-                color:        internal.colors.dark
+                color:        Internal.colors.dark
                 antialiasing: true
             }
         }
@@ -92,7 +95,7 @@ Rectangle {
             ColorOverlay {
                 anchors.fill: minimizeIcon
                 source:       minimizeIcon
-                color:        internal.colors.dark
+                color:        Internal.colors.dark
                 antialiasing: true
             }
         }
@@ -147,7 +150,7 @@ Rectangle {
 
             // Props
             hasShadow:       true
-            backgroundColor: internal.colors.background
+            backgroundColor: Internal.colors.background
 
             anchors.left:       parent.left
             anchors.leftMargin: 20
@@ -182,7 +185,7 @@ Rectangle {
             ColorOverlay {
                 anchors.fill: icon
                 source:       icon
-                color:        internal.colors.light
+                color:        Internal.colors.light
                 antialiasing: true
             }
         }
@@ -191,7 +194,7 @@ Rectangle {
         Components.Text {
             id:    titleText
             text:  title
-            color: internal.colors.dark
+            color: Internal.colors.dark
 
             font.pointSize: 40
             font.weight:    Font.DemiBold
@@ -1,6 +1,9 @@
 import QtQuick
 import QtQuick.Controls
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -59,7 +62,7 @@ Item {
         width:  root.width
         clip:   true
 
-        backgroundColor: internal.colors.foreground
+        backgroundColor: Internal.colors.foreground
 
         anchors.horizontalCenter: parent.horizontalCenter
 
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -62,7 +65,7 @@ Components.Popup {
         width:  60
         height: 60
 
-        backgroundColor: internal.colors.background
+        backgroundColor: Internal.colors.background
 
         anchors.bottom:           parent.bottom
         anchors.bottomMargin:     25
@@ -87,7 +90,7 @@ Components.Popup {
         ColorOverlay {
             anchors.fill: _icon
             source:       _icon
-            color:        internal.colors.light
+            color:        Internal.colors.light
             antialiasing: true
         }
     }
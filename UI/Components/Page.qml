@@ -1,4 +1,5 @@
 import QtQuick
+import QtQuick.Controls
 
 // Components
 import "qrc:/Components" as Components
@@ -28,10 +29,21 @@ Item {
 
     property var onRoute: function(){}
 
+    // Built by the page loader, the stack only destroys pages it created itself
+    property bool isPreloaded: false
+
     Component.onCompleted: function() {
         onRoute();
     }
 
+    StackView.onRemoved: function() {
+        if (!isPreloaded) {
+            return;
+        }
+
+        destroy();
+    }
+
     Components.Header {
         id: header
 
@@ -0,0 +1,69 @@
+import QtQuick
+
+// Incubates pages ahead of navigation, push() hands the built page to the stack instead of creating it on the spot
+QtObject {
+    id: _root
+
+    required property var stack
+
+    // Url -> { component, incubator }
+    property var _pages: ({})
+
+    function preload(inUrl) {
+        if (_root._pages[inUrl]) {
+            return;
+        }
+
+        const component = Qt.createComponent(inUrl, Component.Asynchronous);
+        const entry     = { component: component, incubator: null };
+
+        _root._pages[inUrl] = entry;
+
+        const incubate = function() {
+            if (component.status === Component.Loading || _root._pages[inUrl] !== entry) {
+                return;
+            }
+
+            if (component.status !== Component.Ready) {
+                delete _root._pages[inUrl];
+
+                return;
+            }
+
+            entry.incubator = component.incubateObject(
+                _root.stack,
+                { visible: false, isPreloaded: true },
+                Qt.Asynchronous
+            );
+        };
+
+        if (component.status === Component.Loading) {
+            component.statusChanged.connect(incubate);
+
+            return;
+        }
+
+        incubate();
+    }
+
+    function push(inUrl) {
+        const entry = _root._pages[inUrl];
+
+        delete _root._pages[inUrl];
+
+        if (!entry || !entry.incubator) {
+            return _root.stack.push(inUrl);
+        }
+
+        // Not done yet, finishing it is still cheaper than starting over
+        if (entry.incubator.status === Component.Loading) {
+            entry.incubator.forceCompletion();
+        }
+
+        if (entry.incubator.status !== Component.Ready) {
+            return _root.stack.push(inUrl);
+        }
+
+        return _root.stack.push(entry.incubator.object);
+    }
+}
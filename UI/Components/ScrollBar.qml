@@ -1,6 +1,9 @@
 import QtQuick
 import QtQuick.Controls.Basic
 
+// Types
+import Financy.Types 1.0
+
 ScrollBar {
     // Input
     required property bool isVertical
@@ -24,7 +27,7 @@ ScrollBar {
     background: Item {}
     contentItem: Rectangle {
         radius: width / 2
-        color:  _scrollBar.pressed ? internal.colors.light : internal.colors.dark
+        color:  _scrollBar.pressed ? Internal.colors.light : Internal.colors.dark
 
         // Horizontal
         anchors.verticalCenter: isVertical ? undefined : parent.verticalCenter
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -30,6 +33,6 @@ Components.Button {
         hasShadow:              isDisabled && disableWillOverwrite ? false : _root.hasShadow
         backgroundColor:        isDisabled && disableWillOverwrite ? "transparent" : _root.backgroundColor
         backgroundBorder.width: isDisabled && disableWillOverwrite ? 2.5 :  0
-        backgroundBorder.color: isDisabled && disableWillOverwrite ? internal.colors.foreground : "transparent"
+        backgroundBorder.color: isDisabled && disableWillOverwrite ? Internal.colors.foreground : "transparent"
     }
 }
\ No newline at end of file
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls.Basic
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -13,8 +16,8 @@ Item {
     property alias buttonWidth:  _switch.width
 
     property bool isSwitched:   false
-    property string color:      internal.colors.light
-    property string fill:       internal.colors.foreground
+    property string color:      Internal.colors.light
+    property string fill:       Internal.colors.foreground
 
     property var onSwitch
 
@@ -2,6 +2,9 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
 // Components
 import "qrc:/Components" as Components
 
@@ -11,6 +14,11 @@ Components.Page {
 
     title: "Login"
 
+    // Logging in is what usually comes next
+    StackView.onActivated: function() {
+        pages.preload("qrc:/Pages/UserHome.qml");
+    }
+
     leftButtonIcon: _isDeleting ? "qrc:/Icons/Close.svg" : "qrc:/Icons/Trash.svg" 
     leftButtonOnClick: function() {
         _isDeleting = !_isDeleting;
@@ -39,17 +47,17 @@ Components.Page {
 
             anchors.fill: parent
 
-            model:    internal.users
+            model:    Internal.users
             delegate: Components.ButtonUser {
                 width:        parent.width * 0.8
                 contentWidth: (parent.width * 0.87) - _delete.width
 
-                property var user: internal.users[index]
+                property var user: Internal.users[index]
 
                 onClick: function() {
-                    internal.login(user.id);
+                    Internal.login(user.id);
     
-                    stack.push("qrc:/Pages/UserHome.qml")
+                    pages.push("qrc:/Pages/UserHome.qml")
                 }
 
                 onHover: function(inMouseArea) {
@@ -75,7 +83,7 @@ Components.Page {
                 }
 
                 text:           user?.getFullName() ?? ""
-                picture:        user?.picture ?? ""
+                picture:        user?.avatar ?? ""
                 primaryColor:   user?.primaryColor ?? ""
                 secondaryColor: user?.secondaryColor ?? ""
 
@@ -158,14 +166,14 @@ Components.Page {
             height: 180
 
             hasShadow:       true
-            backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+            backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
 
             anchors.horizontalCenter: parent.horizontalCenter
             anchors.verticalCenter:   parent.verticalCenter
 
             Components.Text {
                 id:    _title
-                color: internal.colors.dark
+                color: Internal.colors.dark
                 text:  "You're about to delete the user " + _deletingUser?.getFullName().trim() ?? "NULL" + " , are you sure?"
 
                 font.pointSize: 15
@@ -178,7 +186,7 @@ Components.Page {
 
             Components.Text {
                 id:    _disclaimer
-                color: internal.colors.light
+                color: Internal.colors.light
                 text:  "This action cannot be reversed"
 
                 font.pointSize: 12
@@ -194,14 +202,14 @@ Components.Page {
                 width:  parent.width * 0.45
                 height: 60
 
-                backgroundColor: internal.colors.dark
+                backgroundColor: Internal.colors.dark
 
                 anchors.bottom:           parent.bottom
                 anchors.bottomMargin:     25
                 anchors.horizontalCenter: parent.horizontalCenter
 
                 onClick: function() {
-                    internal.deleteUser(_deletingUser.id);
+                    Internal.deleteUser(_deletingUser.id);
 
                     _deletionPopup.close();
 
@@ -210,7 +218,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Delete"
-                    color: internal.colors.background
+                    color: Internal.colors.background
 
                     font.weight:    Font.Bold
                     font.pointSize: 15
@@ -2,16 +2,34 @@ import QtQuick
 import QtQuick.Controls
 import Qt5Compat.GraphicalEffects
 
+// Types
+import Financy.Types 1.0
+
+// Components
+import "qrc:/Components" as Components
+
 Item {
     anchors.fill: parent
 
+    Shortcut {
+        sequences:   [ StandardKey.Undo ]
+        enabled:     Internal.journal.canUndo
+        onActivated: Internal.undo()
+    }
+
+    Shortcut {
+        sequences:   [ StandardKey.Redo ]
+        enabled:     Internal.journal.canRedo
+        onActivated: Internal.redo()
+    }
+
     Rectangle {
         id:           mask
         radius:       4
-        color:        internal.colors.background
+        color:        Internal.colors.background
 
         border.width: 1
-        border.color: Qt.lighter(internal.colors.dark, 0.5)
+        border.color: Qt.lighter(Internal.colors.dark, 0.5)
         anchors.fill: parent
 
         Behavior on color {
@@ -35,4 +53,9 @@ Item {
             anchors.fill: parent
         }
     }
+
+    Components.PageLoader {
+        id:    pages
+        stack: stack
+    }
 }
\ No newline at end of file
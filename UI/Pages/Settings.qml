@@ -20,12 +20,12 @@ Components.Page {
 
         anchors.horizontalCenter: parent.horizontalCenter
 
-        backgroundColor: internal.colors.background
+        backgroundColor: Internal.colors.background
         hasShadow:       true
 
         Components.Text {
             text:  "Theme"
-            color: internal.colors.dark
+            color: Internal.colors.dark
 
             font.pointSize: 16
             font.weight:    Font.Bold
@@ -38,7 +38,7 @@ Components.Page {
         Rectangle {
             width:  1
             height: parent.height - (_theme._padding * 1.5)
-            color:  internal.colors.light
+            color:  Internal.colors.light
 
             anchors.right:          _switch.left
             anchors.rightMargin:    10
@@ -61,12 +61,12 @@ Components.Page {
             anchors.rightMargin:    _theme._padding
             anchors.verticalCenter: parent.verticalCenter
 
-            color:      internal.colors.background
-            fill:       internal.colors.light
-            isSwitched: internal.colorsTheme == Colors.Dark
+            color:      Internal.colors.background
+            fill:       Internal.colors.light
+            isSwitched: Internal.colorsTheme == Colors.Dark
 
             onSwitch: function() {
-                internal.updateTheme(internal.colorsTheme == Colors.Dark ? Colors.Light : Colors.Dark);
+                Internal.updateTheme(Internal.colorsTheme == Colors.Dark ? Colors.Light : Colors.Dark);
             }
         }
     }
@@ -9,7 +9,7 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Page {
-    readonly property var user: internal.selectedUser
+    readonly property var user: Internal.selectedUser
     
     property var _accountToShare
 
@@ -28,9 +28,9 @@ Components.Page {
         }
 
         if (_form.willBeShared) {
-            internal.addAccount(_accountToShare.id);
+            Internal.addAccount(_accountToShare.id);
         } else {
-            internal.createAccount(
+            Internal.createAccount(
                 _name.text,
                 _closingDay.text,
                 _limit.text,
@@ -50,8 +50,8 @@ Components.Page {
         _closingDay.clear();
         _limit.clear();
         _type.clear();
-        _primaryColor.set(internal.colors.dark);
-        _secondaryColor.set(internal.colors.background);
+        _primaryColor.set(Internal.colors.dark);
+        _secondaryColor.set(Internal.colors.background);
     }
 
     Item {
@@ -69,7 +69,7 @@ Components.Page {
             height: 40
 
             backgroundBorder.width: 1
-            backgroundBorder.color: internal.colors.foreground
+            backgroundBorder.color: Internal.colors.foreground
 
             anchors.top:              parent.top
             anchors.topMargin:        25
@@ -79,7 +79,7 @@ Components.Page {
                 width:  parent.width * 0.5
                 height: parent.height
 
-                backgroundColor:             _form.willBeShared ? "transparent" : internal.colors.dark
+                backgroundColor:             _form.willBeShared ? "transparent" : Internal.colors.dark
                 backgroundTopRightRadius:    0
                 backgroundBottomRightRadius: 0
 
@@ -93,7 +93,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "New"
-                    color: _form.willBeShared ? internal.colors.dark : internal.colors.background
+                    color: _form.willBeShared ? Internal.colors.dark : Internal.colors.background
 
                     font.weight:    Font.Bold
                     font.pointSize: 11
@@ -105,7 +105,7 @@ Components.Page {
             Rectangle {
                 width:  1
                 height: parent.height
-                color:  internal.colors.foreground
+                color:  Internal.colors.foreground
 
                 anchors.centerIn: parent
             }
@@ -114,7 +114,7 @@ Components.Page {
                 width:  parent.width * 0.5
                 height: parent.height
 
-                backgroundColor:            _form.willBeShared ? internal.colors.dark : "transparent"
+                backgroundColor:            _form.willBeShared ? Internal.colors.dark : "transparent"
                 backgroundTopLeftRadius:    0
                 backgroundBottomLeftRadius: 0
     
@@ -128,7 +128,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Shared"
-                    color: _form.willBeShared ? internal.colors.background : internal.colors.dark
+                    color: _form.willBeShared ? Internal.colors.background : Internal.colors.dark
 
                     font.weight:    Font.Bold
                     font.pointSize: 11
@@ -151,7 +151,7 @@ Components.Page {
                 width: 256 * 1.25
 
                 label:     "Name"
-                color:     internal.colors.dark
+                color:     Internal.colors.dark
                 minLength: 1
                 maxLength: 25
 
@@ -166,7 +166,7 @@ Components.Page {
                 width: _name.width
 
                 label: "Limit"
-                color: internal.colors.dark
+                color: Internal.colors.dark
                 hint:  "> 1"
 
                 validator: IntValidator {
@@ -190,14 +190,14 @@ Components.Page {
                 anchors.horizontalCenter: parent.horizontalCenter
 
                 Components.Input {
-                    property int min: internal.getMinStatementClosingDay()
-                    property int max: internal.getMaxStatementClosingDay()
+                    property int min: Internal.getMinStatementClosingDay()
+                    property int max: Internal.getMaxStatementClosingDay()
     
                     id:     _closingDay
                     width:  (parent.width / 2) - 10
 
                     label: "Closing day" 
-                    color: internal.colors.dark
+                    color: Internal.colors.dark
                     hint:  _closingDay.min + " ~ " + _closingDay.max
 
                     anchors.left: parent.left
@@ -214,7 +214,7 @@ Components.Page {
                     itemWidth:  _closingDay.width
                     itemHeight: _closingDay.inputHeight
 
-                    model: internal.getAccountTypes()
+                    model: Internal.getAccountTypes()
 
                     anchors.right: parent.right
                 }
@@ -232,7 +232,7 @@ Components.Page {
                     id:     _primaryColor
                     width:  (parent.width / 2) - 15
                     height: 60
-                    color:  internal.colors.dark
+                    color:  Internal.colors.dark
                     label:  "Background Color"
 
                     anchors.left:           parent.left
@@ -243,7 +243,7 @@ Components.Page {
                     id:     _secondaryColor
                     width:  _primaryColor.width
                     height: _primaryColor.height
-                    color:  internal.colors.background
+                    color:  Internal.colors.background
                     label:  "Text Color"
 
                     anchors.left:           _primaryColor.right
@@ -276,7 +276,7 @@ Components.Page {
                     _name.set(            inAccount.name)
                     _closingDay.set(      inAccount.closingDay);
                     _limit.set(           inAccount.limit);
-                    _type.set(            internal.getAccountTypeName(inAccount.type));
+                    _type.set(            Internal.getAccountTypeName(inAccount.type));
                     _primaryColor.set(    inAccount.primaryColor);
                     _secondaryColor.set(  inAccount.secondaryColor);
                 }
@@ -296,7 +296,7 @@ Components.Page {
             id:               _secondPreviewButton
             width:            parent.width * 0.9
             height:           parent.height
-            backgroundColor:  internal.showcaseColors.background
+            backgroundColor:  Internal.showcaseColors.background
             hasShadow:        true
 
             anchors.top:              parent.top
@@ -305,7 +305,7 @@ Components.Page {
             Components.Text {
                 id:    _secondPreviewTitle
                 text:  "Preview"
-                color: internal.showcaseColors.light
+                color: Internal.showcaseColors.light
 
                 font.family:    "Inter"           
                 font.pointSize: 25
@@ -320,15 +320,15 @@ Components.Page {
             Components.Switch {
                 id: _switch
 
-                color: internal.showcaseColors.light
-                fill:  internal.showcaseColors.foreground
+                color: Internal.showcaseColors.light
+                fill:  Internal.showcaseColors.foreground
                 width: 60
 
                 labelText:    _switch.isSwitched ? "Dark" : "Light"
 
                 buttonHeight: 28
 
-                isSwitched:   internal.colorsTheme == Colors.Dark
+                isSwitched:   Internal.colorsTheme == Colors.Dark
 
                 anchors.top:         parent.top
                 anchors.right:       parent.right
@@ -336,7 +336,7 @@ Components.Page {
                 anchors.rightMargin: parent.width * 0.05
 
                 onSwitch: function() {
-                    internal.updateShowcaseTheme(
+                    Internal.updateShowcaseTheme(
                         _switch.isSwitched ? Colors.Dark : Colors.Light
                     );
                 }
@@ -9,8 +9,8 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Page {
-    readonly property var user:    internal.selectedUser
-    readonly property var account: internal.selectedAccount
+    readonly property var user:    Internal.selectedUser
+    readonly property var account: Internal.selectedAccount
 
     property var _accountToShare
 
@@ -35,7 +35,7 @@ Components.Page {
 
             stack.popToIndex(1);
 
-            internal.mergeAccounts(
+            Internal.mergeAccounts(
                 account.id,
                 _accountToShare.id
             );
@@ -43,7 +43,7 @@ Components.Page {
             return;
         }
 
-        internal.editAccount(
+        Internal.editAccount(
             account.id,
             _name.text,
             _closingDay.text,
@@ -71,7 +71,7 @@ Components.Page {
             height: 40
 
             backgroundBorder.width: 1
-            backgroundBorder.color: internal.colors.foreground
+            backgroundBorder.color: Internal.colors.foreground
 
             anchors.top:              parent.top
             anchors.topMargin:        25
@@ -81,7 +81,7 @@ Components.Page {
                 width:  parent.width * 0.5
                 height: parent.height
 
-                backgroundColor:             _form.willBeShared ? "transparent" : internal.colors.dark
+                backgroundColor:             _form.willBeShared ? "transparent" : Internal.colors.dark
                 backgroundTopRightRadius:    0
                 backgroundBottomRightRadius: 0
 
@@ -93,7 +93,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Edit"
-                    color: _form.willBeShared ? internal.colors.dark : internal.colors.background
+                    color: _form.willBeShared ? Internal.colors.dark : Internal.colors.background
 
                     font.weight:    Font.Bold
                     font.pointSize: 11
@@ -105,7 +105,7 @@ Components.Page {
             Rectangle {
                 width:  1
                 height: parent.height
-                color:  internal.colors.foreground
+                color:  Internal.colors.foreground
 
                 anchors.centerIn: parent
             }
@@ -114,7 +114,7 @@ Components.Page {
                 width:  parent.width * 0.5
                 height: parent.height
 
-                backgroundColor:            _form.willBeShared ? internal.colors.dark : "transparent"
+                backgroundColor:            _form.willBeShared ? Internal.colors.dark : "transparent"
                 backgroundTopLeftRadius:    0
                 backgroundBottomLeftRadius: 0
     
@@ -126,7 +126,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Shared"
-                    color: _form.willBeShared ? internal.colors.background : internal.colors.dark
+                    color: _form.willBeShared ? Internal.colors.background : Internal.colors.dark
 
                     font.weight:    Font.Bold
                     font.pointSize: 11
@@ -150,7 +150,7 @@ Components.Page {
                 text:  account?.name ?? ""
 
                 label:     "Name"
-                color:     internal.colors.dark
+                color:     Internal.colors.dark
                 minLength: 1
                 maxLength: 25
 
@@ -166,7 +166,7 @@ Components.Page {
                 text:  account?.limit ?? 0
 
                 label: "Limit"
-                color: internal.colors.dark
+                color: Internal.colors.dark
 
                 validator: IntValidator {
                     bottom: 1
@@ -189,15 +189,15 @@ Components.Page {
                 anchors.horizontalCenter: parent.horizontalCenter
 
                 Components.Input {
-                    property int min: internal.getMinStatementClosingDay()
-                    property int max: internal.getMaxStatementClosingDay()
+                    property int min: Internal.getMinStatementClosingDay()
+                    property int max: Internal.getMaxStatementClosingDay()
 
                     id:     _closingDay
                     width:  (parent.width / 2) - 10
                     text:   account?.closingDay ?? 1
 
                     label:       "Closing Day" 
-                    color:       internal.colors.dark
+                    color:       Internal.colors.dark
                     inputHeight: _limit.inputHeight
                     hint:        _closingDay.min + " ~ " + _closingDay.max
 
@@ -215,7 +215,7 @@ Components.Page {
                     itemWidth:  _closingDay.width
                     itemHeight: _closingDay.inputHeight
 
-                    model: internal.getAccountTypes()
+                    model: Internal.getAccountTypes()
 
                     anchors.right:     parent.right
                 }
@@ -233,7 +233,7 @@ Components.Page {
                     id:     _primaryColor
                     width:  (parent.width / 2) - 15
                     height: 60
-                    color:  account?.primaryColor ?? internal.colors.dark
+                    color:  account?.primaryColor ?? Internal.colors.dark
                     label:  "Background Color"
 
                     anchors.left:           parent.left
@@ -244,7 +244,7 @@ Components.Page {
                     id:     _secondaryColor
                     width:  _primaryColor.width
                     height: _primaryColor.height
-                    color:  account?.secondaryColor ?? internal.colors.foreground
+                    color:  account?.secondaryColor ?? Internal.colors.foreground
                     label:  "Text Color"
 
                     anchors.left:           _primaryColor.right
@@ -290,7 +290,7 @@ Components.Page {
             id:               _secondPreviewButton
             width:            parent.width * 0.9
             height:           parent.height
-            backgroundColor:  internal.showcaseColors.background
+            backgroundColor:  Internal.showcaseColors.background
             hasShadow:        true
 
             anchors.top:              parent.top
@@ -299,7 +299,7 @@ Components.Page {
             Components.Text {
                 id:    _secondPreviewTitle
                 text:  "Preview"
-                color: internal.showcaseColors.light
+                color: Internal.showcaseColors.light
 
                 font.family:    "Inter"           
                 font.pointSize: 25
@@ -314,15 +314,15 @@ Components.Page {
             Components.Switch {
                 id: _switch
 
-                color: internal.showcaseColors.light
-                fill:  internal.showcaseColors.foreground
+                color: Internal.showcaseColors.light
+                fill:  Internal.showcaseColors.foreground
                 width: 60
 
                 labelText: _switch.isSwitched ? "Dark" : "Light"
 
                 buttonHeight: 28
 
-                isSwitched:   internal.colorsTheme == Colors.Dark
+                isSwitched:   Internal.colorsTheme == Colors.Dark
 
                 anchors.top:         parent.top
                 anchors.right:       parent.right
@@ -330,7 +330,7 @@ Components.Page {
                 anchors.rightMargin: parent.width * 0.05
 
                 onSwitch: function() {
-                    internal.updateShowcaseTheme(
+                    Internal.updateShowcaseTheme(
                         _switch.isSwitched ? Colors.Dark : Colors.Light
                     );
                 }
@@ -9,8 +9,8 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Page {
-    readonly property var user:    internal.selectedUser
-    readonly property var account: internal.selectedAccount
+    readonly property var user:    Internal.selectedUser
+    readonly property var account: Internal.selectedAccount
 
     property int purchaseHeight:       45
     property int statementTitleHeight: 40
@@ -41,15 +41,49 @@ Components.Page {
         _purchaseCreation.open();
     }
 
+    rightButtonIcon: "qrc:/Icons/Download.svg"
+    rightButtonOnClick: function() {
+        if (!user || !account) {
+            return;
+        }
+
+        var result = Internal.openFileDialog(
+            "Select Bank Statement",
+            "csv;ofx;qfx"
+        );
+
+        if (result === "") {
+            return;
+        }
+
+        _root.clearListing();
+
+        account.importPurchases(result);
+
+        _root.user.onEdit();
+
+        _root._refreshListing();
+    }
+
     onReturn: function() {
         _history.visible = false;
 
         clearListing();
 
-        internal.deselect();
+        Internal.deselect();
     }
 
     onUserChanged: function () {
+        _updateUsers();
+    }
+
+    // Set after creation when the page was preloaded
+    onAccountChanged: function() {
+        _updateUsers();
+        _refreshListing();
+    }
+
+    function _updateUsers() {
         _userFilter.clear();
 
         if (!user || !account || !account.isOwnedBy(user.id)) {
@@ -70,7 +104,7 @@ Components.Page {
             userIds.push(sharedUser);
         });
 
-        const sharedUsers = userIds.map((_) => internal.getUser(_));
+        const sharedUsers = userIds.map((_) => Internal.getUser(_));
         sharedUsers.push(user);
 
         if (userIds.length > 0) {
@@ -83,14 +117,18 @@ Components.Page {
     }
 
     function clearListing() {
-        _history.refresh([]);
+        _history.refresh(null);
         _purchases.clear();
     }
 
     function _refreshListing() {
         _root.clearListing();
 
-        _history.refresh(_root.account.history);
+        if (!_root.account) {
+            return;
+        }
+
+        _history.refresh(_root.account.historyModel);
     }
 
     function _updateFilter(inId) {
@@ -144,7 +182,7 @@ Components.Page {
     Components.Text {
         id:      _historyYear
         text:    _history.selectedHistory?.date.getFullYear() ?? ""
-        color:   internal.colors.dark
+        color:   Internal.colors.dark
         visible: !!_history.selectedHistory
 
         font.pointSize: 20
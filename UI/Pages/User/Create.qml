@@ -22,7 +22,7 @@ Components.Page {
             return;
         }
 
-        var user = internal.createUser(
+        var user = Internal.createUser(
             firstName.text,
             lastName.text,
             income.text,
@@ -38,6 +38,19 @@ Components.Page {
         stack.pop();
     }
 
+    Connections {
+        target: Internal
+
+        function onOnUserColorsUpdate(inImage, inColors) {
+            if (inImage !== _root.profilePicture) {
+                return;
+            }
+
+            _primaryColor.color   = inColors[0];
+            _secondaryColor.color = inColors[1];
+        }
+    }
+
     Item {
         id:     _formPicture
         width:  parent.width * 0.6
@@ -49,7 +62,7 @@ Components.Page {
             id:              picture
             width:           256
             height:          256
-            backgroundColor: internal.colors.foreground
+            backgroundColor: Internal.colors.foreground
 
             anchors.horizontalCenter: parent.horizontalCenter
 
@@ -64,7 +77,7 @@ Components.Page {
             }
 
             onClick: function() {
-                var result = internal.openFileDialog(
+                var result = Internal.openFileDialog(
                     "Select Profile Picture",
                     "jpg;jpeg;png"
                 );
@@ -77,10 +90,7 @@ Components.Page {
                 _root.wasPictureSelected = true;
                 _root.profilePicture     = result;
 
-                var colors = internal.getUserColorsFromImage(result);
-
-                _primaryColor.color   = colors[0];
-                _secondaryColor.color = colors[1];
+                Internal.requestUserColorsFromImage(result);
             }
 
             Image {
@@ -99,7 +109,7 @@ Components.Page {
             ColorOverlay {
                 id:           iconMask
                 source:       icon
-                color:        internal.colors.dark
+                color:        Internal.colors.dark
                 antialiasing: true
                 visible:      !_root.wasPictureSelected
                 anchors.fill: icon
@@ -109,7 +119,7 @@ Components.Page {
                 id:     plusContainer
                 width:  parent.width
                 height: 60
-                color:  internal.colors.dark
+                color:  Internal.colors.dark
 
                 bottomLeftRadius:  15
                 bottomRightRadius: 15
@@ -131,7 +141,7 @@ Components.Page {
                 ColorOverlay {
                     anchors.fill: plusIcon
                     source:       plusIcon
-                    color:        internal.colors.background
+                    color:        Internal.colors.background
                     antialiasing: true
                 }
             }
@@ -142,7 +152,7 @@ Components.Page {
             width: picture.width * 1.25
 
             label:     "First name"
-            color:     internal.colors.dark
+            color:     Internal.colors.dark
             minLength: 2
             maxLength: 20
 
@@ -158,7 +168,7 @@ Components.Page {
             width: firstName.width
 
             label:      "Last name"
-            color:      internal.colors.dark
+            color:      Internal.colors.dark
             minLength:  2
             maxLength:  20
             isRequired: false
@@ -173,7 +183,7 @@ Components.Page {
             width: firstName.width
 
             label:      "Income"
-            color:      internal.colors.dark
+            color:      Internal.colors.dark
             isRequired: true
 
             validator: DoubleValidator {
@@ -199,7 +209,7 @@ Components.Page {
                 id:     _primaryColor
                 width:  (parent.width / 2) - 15
                 height: 60
-                color:  internal.colors.foreground
+                color:  Internal.colors.foreground
                 label:  "Primary Color"
 
                 anchors.left:           parent.left
@@ -210,7 +220,7 @@ Components.Page {
                 id:     _secondaryColor
                 width:  _primaryColor.width
                 height: _primaryColor.height
-                color:  internal.colors.dark
+                color:  Internal.colors.dark
                 label:  "Secondary Color"
 
                 anchors.left:           _primaryColor.right
@@ -232,7 +242,7 @@ Components.Page {
             id:               _secondPreviewButton
             width:            parent.width * 0.9
             height:           parent.height
-            backgroundColor:  internal.showcaseColors.background
+            backgroundColor:  Internal.showcaseColors.background
             hasShadow:        true
 
             anchors.top:              parent.top
@@ -241,7 +251,7 @@ Components.Page {
             Components.Text {
                 id:    _secondPreviewTitle
                 text:  "Preview"
-                color: internal.showcaseColors.light
+                color: Internal.showcaseColors.light
 
                 font.family:    "Inter"           
                 font.pointSize: 25
@@ -256,15 +266,15 @@ Components.Page {
             Components.Switch {
                 id: _switch
 
-                color: internal.showcaseColors.light
-                fill:  internal.showcaseColors.foreground
+                color: Internal.showcaseColors.light
+                fill:  Internal.showcaseColors.foreground
                 width: 60
 
                 labelText:    _switch.isSwitched ? "Dark" : "Light"
 
                 buttonHeight: 28
 
-                isSwitched:   internal.colorsTheme == Colors.Dark
+                isSwitched:   Internal.colorsTheme == Colors.Dark
 
                 anchors.top:         parent.top
                 anchors.right:       parent.right
@@ -272,7 +282,7 @@ Components.Page {
                 anchors.rightMargin: parent.width * 0.05
 
                 onSwitch: function() {
-                    internal.updateShowcaseTheme(
+                    Internal.updateShowcaseTheme(
                         _switch.isSwitched ? Colors.Dark : Colors.Light
                     );
                 }
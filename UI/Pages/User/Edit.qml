@@ -8,7 +8,7 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Page {
-    readonly property var user: internal.selectedUser
+    readonly property var user: Internal.selectedUser
 
     property var profilePicture:  ""
     
@@ -24,7 +24,7 @@ Components.Page {
             return;
         }
 
-        internal.editUser(
+        Internal.editUser(
             user.id,
             firstName.text,
             lastName.text,
@@ -47,6 +47,19 @@ Components.Page {
         _root.profilePicture  = user.picture;
     }
 
+    Connections {
+        target: Internal
+
+        function onOnUserColorsUpdate(inImage, inColors) {
+            if (inImage !== _root.profilePicture) {
+                return;
+            }
+
+            _primaryColor.color   = inColors[0];
+            _secondaryColor.color = inColors[1];
+        }
+    }
+
     Item {
         id:     _formPicture
         width:  parent.width * 0.6
@@ -58,7 +71,7 @@ Components.Page {
             id:              picture
             width:           256
             height:          256
-            backgroundColor: internal.colors.foreground
+            backgroundColor: Internal.colors.foreground
 
             anchors.horizontalCenter: parent.horizontalCenter
 
@@ -73,7 +86,7 @@ Components.Page {
             }
 
             onClick: function() {
-                var result = internal.openFileDialog(
+                var result = Internal.openFileDialog(
                     "Select Profile Picture",
                     "jpg;jpeg;png"
                 );
@@ -85,10 +98,7 @@ Components.Page {
 
                 _root.profilePicture = result;
 
-                var colors = internal.getUserColorsFromImage(result);
-
-                _primaryColor.color   = colors[0];
-                _secondaryColor.color = colors[1];
+                Internal.requestUserColorsFromImage(result);
             }
 
             Image {
@@ -108,7 +118,7 @@ Components.Page {
                 id:     plusContainer
                 width:  parent.width
                 height: 60
-                color:  internal.colors.dark
+                color:  Internal.colors.dark
 
                 bottomLeftRadius:  15
                 bottomRightRadius: 15
@@ -130,7 +140,7 @@ Components.Page {
                 ColorOverlay {
                     anchors.fill: plusIcon
                     source:       plusIcon
-                    color:        internal.colors.background
+                    color:        Internal.colors.background
                     antialiasing: true
                 }
             }
@@ -142,7 +152,7 @@ Components.Page {
             text:  user?.firstName ?? ""
 
             label:     "First name"
-            color:     internal.colors.dark
+            color:     Internal.colors.dark
             minLength: 2
             maxLength: 20
 
@@ -159,7 +169,7 @@ Components.Page {
             text:  user?.lastName ?? ""
 
             label:      "Last name"
-            color:      internal.colors.dark
+            color:      Internal.colors.dark
             minLength:  2
             maxLength:  20
             isRequired: false
@@ -175,7 +185,7 @@ Components.Page {
             text:  user?.income ? user?.income.toFixed(2) : 0
 
             label:      "Income"
-            color:      internal.colors.dark
+            color:      Internal.colors.dark
             isRequired: true
 
             validator: DoubleValidator {
@@ -201,7 +211,7 @@ Components.Page {
                 id:     _primaryColor
                 width:  (parent.width / 2) - 15
                 height: 60
-                color:  user?.primaryColor ?? internal.colors.foreground
+                color:  user?.primaryColor ?? Internal.colors.foreground
                 label:  "Primary Color"
 
                 anchors.left:           parent.left
@@ -212,7 +222,7 @@ Components.Page {
                 id:     _secondaryColor
                 width:  _primaryColor.width
                 height: _primaryColor.height
-                color:  user?.secondaryColor ?? internal.colors.dark
+                color:  user?.secondaryColor ?? Internal.colors.dark
                 label:  "Secondary Color"
 
                 anchors.left:           _primaryColor.right
@@ -234,7 +244,7 @@ Components.Page {
             id:               _secondPreviewButton
             width:            parent.width * 0.9
             height:           parent.height
-            backgroundColor:  internal.showcaseColors.background
+            backgroundColor:  Internal.showcaseColors.background
             hasShadow:        true
 
             anchors.top:              parent.top
@@ -243,7 +253,7 @@ Components.Page {
             Components.Text {
                 id:    _secondPreviewTitle
                 text:  "Preview"
-                color: internal.showcaseColors.light
+                color: Internal.showcaseColors.light
 
                 font.family:    "Inter"           
                 font.pointSize: 25
@@ -258,15 +268,15 @@ Components.Page {
             Components.Switch {
                 id: _switch
 
-                color: internal.showcaseColors.light
-                fill:  internal.showcaseColors.foreground
+                color: Internal.showcaseColors.light
+                fill:  Internal.showcaseColors.foreground
                 width: 60
 
                 labelText:    _switch.isSwitched ? "Dark" : "Light"
 
                 buttonHeight: 28
 
-                isSwitched:   internal.colorsTheme == Colors.Dark
+                isSwitched:   Internal.colorsTheme == Colors.Dark
 
                 anchors.top:         parent.top
                 anchors.right:       parent.right
@@ -274,7 +284,7 @@ Components.Page {
                 anchors.rightMargin: parent.width * 0.05
 
                 onSwitch: function() {
-                    internal.updateShowcaseTheme(
+                    Internal.updateShowcaseTheme(
                         _switch.isSwitched ? Colors.Dark : Colors.Light
                     );
                 }
@@ -10,8 +10,10 @@ import Financy.Types 1.0
 import "qrc:/Components" as Components
 
 Components.Page {
-    readonly property var user:   internal.selectedUser
-    readonly property var colors: internal.colors
+    readonly property var user:   Internal.selectedUser
+    readonly property var colors: Internal.colors
+
+    readonly property var dashboard: Internal.dashboard
 
     property var _deletingAccount
 
@@ -20,8 +22,8 @@ Components.Page {
 
     property bool _isOnEditMode: false
 
-    property double _dueAmount: user?.getDueAmount(_userToFilter) ?? 0
-    property double _savedAmount: user?.getSavedAmount(_userToFilter) ?? 0
+    property double _dueAmount: dashboard.dueAmount
+    property double _savedAmount: dashboard.savedAmount
     property double _incomeAmount: user?.income ?? 1.0
 
     property var _currentDate: new Date()
@@ -36,7 +38,7 @@ Components.Page {
 
     centerButtonIcon: "qrc:/Icons/Download.svg"
     centerButtonOnClick: function() {
-        internal.createReport();
+        Internal.createReport();
     }
 
     rightButtonIcon:   "qrc:/Icons/Plus.svg"
@@ -45,11 +47,11 @@ Components.Page {
     }
 
     onReturn: function() {
-        internal.logout();
+        Internal.logout();
     }
 
     onUserChanged: function() {
-        internal.setCurrentDate(new Date());
+        Internal.setCurrentDate(new Date());
 
         if (user)
         {
@@ -59,6 +61,14 @@ Components.Page {
         _updateChart();
     }
 
+    Connections {
+        target: Internal.forecast
+
+        function onOnRefresh() {
+            _root._updateForecastChart();
+        }
+    }
+
     onColorsChanged: function() {
         if (!colors) {
             return;
@@ -84,32 +94,7 @@ Components.Page {
 
         _updateFilter(-1);
 
-        const userIds = [];
-
-        user.accounts.forEach((account) => {
-            if (!account.isOwnedBy(user.id)) {
-                return;
-            }
-
-            account.sharedUserIds.forEach((sharedUser) => {
-                if (userIds.find((user) => user == sharedUser)) {
-                    return;
-                }
-
-                userIds.push(sharedUser);
-            });
-        });
-
-        const sharedUsers = userIds.map((_) => internal.getUser(_));
-        sharedUsers.push(user);
-
-        if (userIds.length > 0) {
-            sharedUsers.push(user);
-        }
-
-        sharedUsers.sort((userA, userB) => userA.id - userB.id);
-
-        _userFilter.model = sharedUsers;
+        _userFilter.model = _root.dashboard.users;
     }
 
     function _updateOverviewChart() {
@@ -117,7 +102,7 @@ Components.Page {
 
         const usedColors = [765, 0];
 
-        const expenseMap = user.getExpenseMap(_root._userToFilter);
+        const expenseMap = _root.dashboard.expenseMap;
 
         for (const key in expenseMap) {
             const createdComponent = _overviewChartPie.append(
@@ -147,10 +132,34 @@ Components.Page {
         }
     }
 
+    function _updateForecastChart() {
+        _forecastDue.clear();
+        _forecastIncome.clear();
+
+        const forecast = Internal.forecast;
+
+        let maxValue = 0;
+
+        for (let i = 0; i < forecast.count; i++) {
+            const month = forecast.get(i);
+
+            _forecastDue.append(   i, month.due);
+            _forecastIncome.append(i, month.income);
+
+            maxValue = Math.max(maxValue, month.due, month.income);
+        }
+
+        _forecastX.max = Math.max(forecast.count - 1, 1);
+        _forecastY.max = maxValue > 0 ? maxValue * 1.1 : 1;
+    }
+
     function _updateFilter(inId) {
         _root._userToFilter = inId;
-        _root._dueAmount    = user.getDueAmount(inId);
-        _root._savedAmount  = user.getSavedAmount(inId);
+
+        _root.dashboard.refresh(inId);
+
+        // Fills in asynchronously, the chart redraws on onRefresh
+        Internal.forecast.refresh(inId);
 
         _updateOverviewChart();
     }
@@ -173,7 +182,7 @@ Components.Page {
             width:  parent.width
             height: parent.height
 
-            backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+            backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
             hasShadow:       true
 
             anchors.horizontalCenter: parent.horizontalCenter
@@ -181,7 +190,7 @@ Components.Page {
             Components.Text {
                 id:    _cardsTitle
                 text:  "Expenses"
-                color: internal.colors.light
+                color: Internal.colors.light
 
                 font.family:    "Inter"
                 font.pointSize: 25
@@ -242,7 +251,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "No expense accounts found"
-                    color: Qt.darker(internal.colors.foreground, 1.1)
+                    color: Qt.darker(Internal.colors.foreground, 1.1)
 
                     font.weight:    Font.Bold
                     font.pointSize: 16
@@ -265,7 +274,7 @@ Components.Page {
                         return;
                     }
 
-                    internal.select(inAccount.id);
+                    Internal.select(inAccount.id);
 
                     stack.push("qrc:/Pages/UserAccountEdit.qml");
                 }
@@ -301,7 +310,7 @@ Components.Page {
             Components.Text {
                 id:    _overviewTitle
                 text:  "Overview"
-                color: internal.colors.light
+                color: Internal.colors.light
 
                 font.family:    "Inter"
                 font.pointSize: 25
@@ -350,8 +359,8 @@ Components.Page {
                 width: _userFilter.itemWidth
 
                 label:       "Date"
-                text:        internal.getLongDate(_root._currentDate)
-                color:       internal.colors.dark
+                text:        Internal.getLongDate(_root._currentDate)
+                color:       Internal.colors.dark
                 inputHeight: _userFilter.itemHeight
 
                 anchors.top:         parent.top
@@ -390,7 +399,7 @@ Components.Page {
                     ColorOverlay {
                         anchors.fill: _dateIcon
                         source:       _dateIcon
-                        color:        _date.isDisabled ? internal.colors.foreground : internal.colors.light
+                        color:        _date.isDisabled ? Internal.colors.foreground : Internal.colors.light
                         antialiasing: true
                     }
                 }
@@ -403,7 +412,7 @@ Components.Page {
                     height: 228
 
                     onSelect: function(date) {
-                        internal.setCurrentDate(date);
+                        Internal.setCurrentDate(date);
 
                         _root._currentDate = date;
 
@@ -415,7 +424,7 @@ Components.Page {
 
             ChartView {
                 id:           _overviewChart
-                height:       parent.height - _overviewTitle.height - savings.height - 20
+                height:       parent.height - _overviewTitle.height - savings.height - _forecastChart.height - 30
                 width:        parent.width - _overviewTitle.height
                 antialiasing: true
                 visible:      _root.expenseAccounts.length > 0
@@ -426,7 +435,7 @@ Components.Page {
 
                 legend.visible:        true
                 legend.markerShape:    Legend.MarkerShapeCircle
-                legend.labelColor:     internal.colors.dark
+                legend.labelColor:     Internal.colors.dark
                 legend.font.family:    "Inter"
                 legend.font.pointSize: 13
                 legend.font.weight:    Font.Bold
@@ -440,14 +449,14 @@ Components.Page {
 
                     contentItem: Components.Text {
                         text:  _tooltip.text
-                        color: internal.colors.background
+                        color: Internal.colors.background
 
                         font.pointSize: 12
                         font.weight:    Font.DemiBold
                     }
 
                     background: Components.SquircleContainer {
-                        backgroundColor: internal.colors.dark
+                        backgroundColor: Internal.colors.dark
                     }
                 }
 
@@ -492,7 +501,7 @@ Components.Page {
                 Components.Text {
                     id:    _overviewInnerText
                     text:  "Total"
-                    color: internal.colors.dark
+                    color: Internal.colors.dark
 
                     font.pointSize: 30
                     font.weight:    Font.Bold
@@ -503,7 +512,7 @@ Components.Page {
 
                 Components.Text {
                     text:  _root._dueAmount.toFixed(2)
-                    color: Qt.lighter(internal.colors.dark, 1.1)
+                    color: Qt.lighter(Internal.colors.dark, 1.1)
 
                     font.pointSize: 22
                     font.weight:    Font.DemiBold
@@ -520,7 +529,7 @@ Components.Page {
                 height: 50
 
                 backgroundWidth: (_root._savedAmount / _root._incomeAmount) * savings.width
-                backgroundColor: Qt.darker(internal.colors.light, 0.9)
+                backgroundColor: Qt.darker(Internal.colors.light, 0.9)
                 backgroundBorder.color: backgroundColor
 
                 anchors.top:              _overviewChart.bottom
@@ -528,7 +537,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Savings " + _root._savedAmount.toFixed(2)
-                    color: Qt.lighter(internal.colors.dark, 1.1)
+                    color: Qt.lighter(Internal.colors.dark, 1.1)
 
                     font.pointSize: 11
                     font.weight:    Font.DemiBold
@@ -537,6 +546,56 @@ Components.Page {
                     anchors.horizontalCenter: parent.horizontalCenter
                 }
             }
+
+            // Due amount against income for the next statements
+            ChartView {
+                id:           _forecastChart
+                width:        savings.width
+                height:       120
+                antialiasing: true
+                visible:      _root.expenseAccounts.length > 0
+
+                backgroundColor:  "transparent"
+                plotAreaColor:    "transparent"
+                animationOptions: ChartView.SeriesAnimations
+
+                legend.visible: false
+
+                anchors.top:              savings.bottom
+                anchors.topMargin:        10
+                anchors.horizontalCenter: parent.horizontalCenter
+
+                ValueAxis {
+                    id:      _forecastX
+                    visible: false
+                    min:     0
+                    max:     1
+                }
+
+                ValueAxis {
+                    id:      _forecastY
+                    visible: false
+                    min:     0
+                    max:     1
+                }
+
+                LineSeries {
+                    id:    _forecastIncome
+                    axisX: _forecastX
+                    axisY: _forecastY
+                    color: Internal.colors.light
+                    width: 2
+                    style: Qt.DashLine
+                }
+
+                LineSeries {
+                    id:    _forecastDue
+                    axisX: _forecastX
+                    axisY: _forecastY
+                    color: Internal.colors.dark
+                    width: 2
+                }
+            }
         }
     }
 
@@ -548,7 +607,7 @@ Components.Page {
             height: 180
 
             hasShadow:       true
-            backgroundColor: Qt.lighter(internal.colors.background, 0.965)
+            backgroundColor: Qt.lighter(Internal.colors.background, 0.965)
 
             anchors.horizontalCenter: parent.horizontalCenter
             anchors.verticalCenter:   parent.verticalCenter
@@ -564,7 +623,7 @@ Components.Page {
 
                 Components.Text {
                     id:    _intialTitle
-                    color: internal.colors.dark
+                    color: Internal.colors.dark
                     text:  "Are you user you want to delete "
 
                     font.pointSize: 15
@@ -579,13 +638,13 @@ Components.Page {
                     width:  _text.paintedWidth + 12.5
                     height: _text.paintedHeight + 2.5
 
-                    backgroundColor: _root._deletingAccount?.primaryColor ?? internal.colors.dark
+                    backgroundColor: _root._deletingAccount?.primaryColor ?? Internal.colors.dark
 
                     anchors.left: _intialTitle.right
 
                     Components.Text {
                         id:    _text
-                        color: _root._deletingAccount?.secondaryColor ?? internal.colors.light
+                        color: _root._deletingAccount?.secondaryColor ?? Internal.colors.light
                         text:  _root._deletingAccount?.name ?? "NULL"
 
                         font.pointSize: 15
@@ -598,7 +657,7 @@ Components.Page {
 
                 Components.Text {
                     id:    _lastTitle
-                    color: internal.colors.dark
+                    color: Internal.colors.dark
                     text:  " ?"
 
                     font.pointSize: 15
@@ -610,7 +669,7 @@ Components.Page {
 
             Components.Text {
                 id:    _disclaimer
-                color: internal.colors.light
+                color: Internal.colors.light
                 text:  "This action cannot be reversed"
 
                 font.pointSize: 12
@@ -626,7 +685,7 @@ Components.Page {
                 width:  parent.width * 0.45
                 height: 60
 
-                backgroundColor: internal.colors.dark
+                backgroundColor: Internal.colors.dark
 
                 anchors.bottom:           parent.bottom
                 anchors.bottomMargin:     25
@@ -639,7 +698,7 @@ Components.Page {
 
                     _accounts.model = [];
 
-                    internal.deleteAccount(_root._deletingAccount.id);
+                    Internal.deleteAccount(_root._deletingAccount.id);
 
                     _deletionPopup.close();
 
@@ -651,7 +710,7 @@ Components.Page {
 
                 Components.Text {
                     text:  "Delete"
-                    color: internal.colors.background
+                    color: Internal.colors.background
 
                     font.weight:    Font.Bold
                     font.pointSize: 15